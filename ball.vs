@@ -0,0 +1,12 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in mat4 aModel; // per instance, locations 1-4
+layout (std140) uniform Camera
+{
+    mat4 view;
+    mat4 projection;
+};
+void main()
+{
+   gl_Position = projection * view * aModel * vec4(aPos, 1.0);
+}
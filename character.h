@@ -1,8 +1,19 @@
+#ifndef CHARACTER_H
+#define CHARACTER_H
+
+#include <glm/glm.hpp>
+
+// metrics of one glyph plus where its bitmap sits inside the glyph atlas
 struct Character {
-    unsigned int TextureID;
     glm::ivec2 Size;
     glm::ivec2 Bearing;
     long Advance;
+    glm::vec2 UVMin;
+    glm::vec2 UVMax;
 };
 
-std::map<char, Character> Characters;
\ No newline at end of file
+// indexed directly by ASCII code point
+const int CHARACTER_COUNT = 128;
+Character Characters[CHARACTER_COUNT];
+
+#endif
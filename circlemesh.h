@@ -0,0 +1,156 @@
+#ifndef CIRCLEMESH_H
+#define CIRCLEMESH_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+// where one tessellated circle lives in the shared vertex buffer; drawn as a
+// triangle fan of count vertices starting at first
+// ------------------------------------------------------------------------
+struct CircleMesh
+{
+    float radius;
+    unsigned int segments;
+    GLint first;
+    GLsizei count;
+};
+
+// builds circle meshes on demand and keeps every (radius, segments) variant
+// in a single vertex buffer, so balls of any size are tessellated once and
+// drawn with one VAO bound. segment counts are powers of two, which lets all
+// of them share one precomputed sin/cos table (a coarser circle just steps
+// through it with a larger stride)
+// ------------------------------------------------------------------------
+class CircleMeshCache
+{
+public:
+    static const unsigned int MIN_SEGMENTS = 8;
+    static const unsigned int MAX_SEGMENTS = 256;
+
+    CircleMeshCache()
+    {
+        // unit circle at MAX_SEGMENTS + 1 angles, the last one closing the fan
+        unitCircle.resize(MAX_SEGMENTS + 1);
+        const double doublePi = 2.0 * M_PI;
+        for(unsigned int i = 0; i <= MAX_SEGMENTS; i++){
+            double angle = doublePi * (i % MAX_SEGMENTS) / MAX_SEGMENTS;
+            unitCircle[i] = glm::vec2((float)std::cos(angle), (float)std::sin(angle));
+        }
+    }
+
+    // fewest segments (power of two) that keep the polygon's edges within
+    // maxError pixels of a true circle of the given on-screen radius
+    // ------------------------------------------------------------------------
+    static unsigned int segmentsForPixelRadius(float pixelRadius, float maxError = 0.25f)
+    {
+        if(!(pixelRadius > maxError))
+            return MIN_SEGMENTS;
+        // a chord of angle a sags r * (1 - cos(a / 2)) below the arc
+        double needed = M_PI / std::acos(1.0 - maxError / pixelRadius);
+        return roundSegments((unsigned int)std::min(std::ceil(needed), (double)MAX_SEGMENTS));
+    }
+
+    // vertex buffer/array the meshes are stored in; owned by the caller
+    // ------------------------------------------------------------------------
+    void attach(unsigned int vertexArray, unsigned int vertexBuffer)
+    {
+        VAO = vertexArray;
+        VBO = vertexBuffer;
+        uploadedVertices = 0;
+
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+    }
+
+    // mesh for a circle of this radius centred on the origin; built and
+    // appended to the shared buffer the first time it is asked for
+    // ------------------------------------------------------------------------
+    const CircleMesh& get(float radius, unsigned int segments)
+    {
+        segments = roundSegments(segments);
+        std::pair<float, unsigned int> key(radius, segments);
+        std::map<std::pair<float, unsigned int>, CircleMesh>::iterator found = meshes.find(key);
+        if(found != meshes.end())
+            return found->second;
+
+        CircleMesh mesh;
+        mesh.radius = radius;
+        mesh.segments = segments;
+        mesh.first = (GLint)(vertices.size() / 3);
+        mesh.count = (GLsizei)(segments + 2);
+
+        // centre, then the rim, repeating the first rim vertex to close the fan
+        vertices.push_back(0.0f);
+        vertices.push_back(0.0f);
+        vertices.push_back(0.0f);
+        unsigned int stride = MAX_SEGMENTS / segments;
+        for(unsigned int i = 0; i <= segments; i++){
+            const glm::vec2 &direction = unitCircle[i * stride];
+            vertices.push_back(radius * direction.x);
+            vertices.push_back(radius * direction.y);
+            vertices.push_back(0.0f);
+        }
+
+        return meshes.insert(std::make_pair(key, mesh)).first->second;
+    }
+
+    // bind the shared VAO, uploading any meshes built since the last bind
+    // ------------------------------------------------------------------------
+    void bind()
+    {
+        upload();
+        glBindVertexArray(VAO);
+    }
+
+    // send meshes created since the last call to the vertex buffer, leaving
+    // the VAO binding alone (for callers that bind it themselves)
+    void upload()
+    {
+        size_t vertexCount = vertices.size() / 3;
+        if(vertexCount != uploadedVertices){
+            glBindBuffer(GL_ARRAY_BUFFER, VBO);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(float) * vertices.size(), vertices.data(), GL_STATIC_DRAW);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            uploadedVertices = vertexCount;
+        }
+    }
+
+    unsigned int vertexArray() const { return VAO; }
+
+    // requires bind()
+    void draw(const CircleMesh &mesh) const
+    {
+        glDrawArrays(GL_TRIANGLE_FAN, mesh.first, mesh.count);
+    }
+
+    size_t meshCount() const { return meshes.size(); }
+
+private:
+    unsigned int VAO = 0;
+    unsigned int VBO = 0;
+
+    std::vector<glm::vec2> unitCircle;
+    std::vector<float> vertices;
+    size_t uploadedVertices = 0;
+    std::map<std::pair<float, unsigned int>, CircleMesh> meshes;
+
+    // next power of two within [MIN_SEGMENTS, MAX_SEGMENTS]
+    static unsigned int roundSegments(unsigned int segments)
+    {
+        unsigned int rounded = MIN_SEGMENTS;
+        while(rounded < segments && rounded < MAX_SEGMENTS)
+            rounded *= 2;
+        return rounded;
+    }
+};
+
+#endif
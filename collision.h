@@ -0,0 +1,194 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include <glm/glm.hpp>
+#include <cmath>
+
+// penetrations shallower than this count as touching, not overlapping, so a
+// ball resting exactly on a surface after a bounce is not pushed again
+const float CONTACT_SLOP = 1e-4f;
+
+// result of a sweep: time of impact as a fraction of the motion, the surface
+// normal at the contact (pointing towards the ball), and whether the ball was
+// already overlapping at the start (then depth is how far it is embedded)
+// ------------------------------------------------------------------------
+struct Contact
+{
+    float t;
+    glm::vec2 normal;
+    bool overlapping;
+    float depth;
+};
+
+// earliest time t in [0, 1] at which a circle of radius r, centred at p and
+// moving by d, touches the axis-aligned box (centre, halfExtents). works on
+// the box grown by r: the flat faces are a slab test, the rounded corners a
+// ray vs circle test
+// ------------------------------------------------------------------------
+inline bool sweepCircleAABB(glm::vec2 p, glm::vec2 d, float r, glm::vec2 center, glm::vec2 halfExtents, Contact &contact)
+{
+    // already overlapping: report the push-out direction instead of a time
+    glm::vec2 closest = glm::clamp(p, center - halfExtents, center + halfExtents);
+    glm::vec2 offset = p - closest;
+    float distance2 = glm::dot(offset, offset);
+    if(distance2 < (r - CONTACT_SLOP) * (r - CONTACT_SLOP)){
+        glm::vec2 normal;
+        float depth;
+        if(distance2 > 0.0f){
+            float distance = std::sqrt(distance2);
+            normal = offset / distance;
+            depth = r - distance;
+        }
+        else{
+            // centre inside the box: leave through the nearest face
+            glm::vec2 local = p - center;
+            glm::vec2 gap = halfExtents - glm::abs(local);
+            if(gap.x < gap.y){
+                normal = glm::vec2(local.x < 0.0f ? -1.0f : 1.0f, 0.0f);
+                depth = gap.x + r;
+            }
+            else{
+                normal = glm::vec2(0.0f, local.y < 0.0f ? -1.0f : 1.0f);
+                depth = gap.y + r;
+            }
+        }
+        contact.t = 0.0f;
+        contact.normal = normal;
+        contact.overlapping = true;
+        contact.depth = depth;
+        return true;
+    }
+
+    // slab test against the box expanded by r
+    glm::vec2 expanded = halfExtents + glm::vec2(r);
+    float tEnter = -INFINITY;
+    float tExit = 1.0f;
+    glm::vec2 normal(0.0f);
+    for(int axis = 0; axis < 2; axis++){
+        float lo = center[axis] - expanded[axis];
+        float hi = center[axis] + expanded[axis];
+        if(d[axis] == 0.0f){
+            if(p[axis] < lo || p[axis] > hi)
+                return false;
+            continue;
+        }
+        float t0 = (lo - p[axis]) / d[axis];
+        float t1 = (hi - p[axis]) / d[axis];
+        float sign = -1.0f;
+        if(t0 > t1){
+            float tmp = t0; t0 = t1; t1 = tmp;
+            sign = 1.0f;
+        }
+        if(t0 > tEnter){
+            tEnter = t0;
+            normal = glm::vec2(0.0f);
+            normal[axis] = sign;
+        }
+        if(t1 < tExit)
+            tExit = t1;
+        if(tEnter > tExit || tExit < 0.0f)
+            return false;
+    }
+
+    // entered before the motion starts: the ball is already touching the
+    // box (any deeper and it was reported as overlapping above), so the
+    // contact is at t = 0 on the face its centre is nearest to
+    if(tEnter < 0.0f){
+        float nearest = INFINITY;
+        for(int axis = 0; axis < 2; axis++){
+            float gapLo = p[axis] - (center[axis] - expanded[axis]);
+            float gapHi = center[axis] + expanded[axis] - p[axis];
+            if(gapLo < nearest){
+                nearest = gapLo;
+                normal = glm::vec2(0.0f);
+                normal[axis] = -1.0f;
+            }
+            if(gapHi < nearest){
+                nearest = gapHi;
+                normal = glm::vec2(0.0f);
+                normal[axis] = 1.0f;
+            }
+        }
+        tEnter = 0.0f;
+    }
+
+    glm::vec2 hit = p + d * tEnter;
+    glm::vec2 local = hit - center;
+
+    // entering the expanded box in a corner region only counts if the ball
+    // actually reaches the rounded corner
+    if(std::fabs(local.x) > halfExtents.x && std::fabs(local.y) > halfExtents.y){
+        glm::vec2 corner = center + glm::vec2(local.x < 0.0f ? -halfExtents.x : halfExtents.x,
+                                              local.y < 0.0f ? -halfExtents.y : halfExtents.y);
+        glm::vec2 m = p - corner;
+        float a = glm::dot(d, d);
+        float b = glm::dot(m, d);
+        float c = glm::dot(m, m) - r * r;
+        float t = 0.0f;
+        // c <= 0: already touching the corner, within CONTACT_SLOP
+        if(c > 0.0f){
+            float discriminant = b * b - a * c;
+            if(a == 0.0f || discriminant < 0.0f)
+                return false;
+            t = (-b - std::sqrt(discriminant)) / a;
+            if(t < 0.0f || t > 1.0f)
+                return false;
+        }
+        tEnter = t;
+        normal = glm::normalize(p + d * t - corner);
+    }
+
+    // only surfaces the ball is moving into can stop it
+    if(glm::dot(d, normal) >= 0.0f)
+        return false;
+
+    contact.t = tEnter;
+    contact.normal = normal;
+    contact.overlapping = false;
+    contact.depth = 0.0f;
+    return true;
+}
+
+// earliest time a circle centred at p moving by d leaves [minBound, maxBound]
+// (its centre's allowed range), with the inward normal of the wall it meets
+// ------------------------------------------------------------------------
+inline bool sweepCircleBounds(glm::vec2 p, glm::vec2 d, glm::vec2 minBound, glm::vec2 maxBound, Contact &contact)
+{
+    bool found = false;
+    for(int axis = 0; axis < 2; axis++){
+        float t;
+        float sign;
+        if(d[axis] > 0.0f){
+            t = (maxBound[axis] - p[axis]) / d[axis];
+            sign = -1.0f;
+        }
+        else if(d[axis] < 0.0f){
+            t = (minBound[axis] - p[axis]) / d[axis];
+            sign = 1.0f;
+        }
+        else{
+            continue;
+        }
+        if(t > 1.0f)
+            continue;
+        if(t < 0.0f)
+            t = 0.0f;
+        if(!found || t < contact.t){
+            contact.t = t;
+            contact.normal = glm::vec2(0.0f);
+            contact.normal[axis] = sign;
+            contact.overlapping = false;
+            contact.depth = 0.0f;
+            found = true;
+        }
+    }
+    return found;
+}
+
+// reflect a velocity off a surface with the given unit normal
+inline glm::vec2 reflectVelocity(glm::vec2 v, glm::vec2 normal)
+{
+    return v - 2.0f * glm::dot(v, normal) * normal;
+}
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef CONTROLLER_H
+#define CONTROLLER_H
+
+#include <cmath>
+#include "world.h"
+
+// source of the paddle's input. next() is asked once before every
+// simulation tick and its answer goes to World::step() (and into a
+// recording) exactly like keyboard input, so anything a player can do a
+// controller can do, headless or in the window
+// ------------------------------------------------------------------------
+class Controller
+{
+public:
+    virtual ~Controller() {}
+    virtual InputFrame next(const World &world) = 0;
+};
+
+// hands out the input it was last given; the windowed build sets it from
+// the keyboard once per frame
+class KeyboardController : public Controller
+{
+public:
+    InputFrame held;
+
+    InputFrame next(const World &) override { return held; }
+};
+
+// plays the game unattended: predicts where the ball that will reach the
+// paddle first crosses the paddle's face, bouncing it off the top and
+// bottom walls and, if it is moving away, off the far wall, and moves the
+// paddle there. targets are ignored by the prediction; a bounce off one
+// just changes the ball's course and the next tick predicts again. assumes
+// the paddle is on the left, like the built-in layout
+// ------------------------------------------------------------------------
+class AutopilotController : public Controller
+{
+public:
+    InputFrame next(const World &world) override
+    {
+        float target = 0.0f;
+        float soonest = -1.0f;
+        for(const Ball &ball : world.balls){
+            float y, time;
+            if(predictIntercept(world, ball, y, time) && (soonest < 0.0f || time < soonest)){
+                target = y;
+                soonest = time;
+            }
+        }
+
+        // closer than one tick of movement counts as there, so the paddle
+        // does not jitter around the target
+        float deadband = world.paddleVelocity * SIM_DT;
+        InputFrame input;
+        input.up = world.paddleY < target - deadband;
+        input.down = world.paddleY > target + deadband;
+        return input;
+    }
+
+    // height at which ball reaches the paddle's face, and the time until
+    // it does; false if it never will (no horizontal motion)
+    // ------------------------------------------------------------------------
+    static bool predictIntercept(const World &world, const Ball &ball, float &y, float &time)
+    {
+        float faceX = world.paddleX + World::PADDLE_HALF_EXTENT + World::CIRCLE_RADIUS;
+        if(ball.velocityX < 0.0f)
+            time = (ball.x - faceX) / -ball.velocityX;
+        else if(ball.velocityX > 0.0f)
+            time = ((World::BOUNDS_X - ball.x) + (World::BOUNDS_X - faceX)) / ball.velocityX;
+        else
+            return false;
+        if(time < 0.0f)
+            time = 0.0f;
+        y = foldIntoBounds(ball.y + ball.velocityY * time, World::BOUNDS_Y);
+        return true;
+    }
+
+    // where a coordinate that moved freely to y ends up when bouncing
+    // between -bound and bound
+    static float foldIntoBounds(float y, float bound)
+    {
+        float period = 4.0f * bound;
+        float folded = std::fmod(y + bound, period);
+        if(folded < 0.0f)
+            folded += period;
+        if(folded > 2.0f * bound)
+            folded = period - folded;
+        return folded - bound;
+    }
+};
+
+#endif
@@ -0,0 +1,170 @@
+#ifndef ENTITYPOOL_H
+#define ENTITYPOOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// stable reference to a pooled entity. index picks a slot and generation
+// must match the slot's current one, so a handle to an entity that has
+// been destroyed stops resolving, even after its slot is reused
+// ------------------------------------------------------------------------
+struct EntityHandle
+{
+    static const uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    uint32_t index = INVALID_INDEX;
+    uint32_t generation = 0;
+
+    bool valid() const { return index != INVALID_INDEX; }
+    bool operator==(const EntityHandle &other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const EntityHandle &other) const { return !(*this == other); }
+};
+
+// entities of one type packed contiguously, addressed through generational
+// handles. spawn and destroy are O(1): destroy moves the last entity into
+// the hole, so iteration over data()/size() always walks a dense array,
+// and freed slots are kept on a free list for the next spawn. storage only
+// grows past its high-water mark (or reserve()), so steady spawn/despawn
+// churn never touches the heap. the dense order is not stable; hold on to
+// handles, not pointers or positions, across a destroy
+// ------------------------------------------------------------------------
+template<typename T>
+class EntityPool
+{
+public:
+    void reserve(size_t count)
+    {
+        items.reserve(count);
+        owners.reserve(count);
+        slots.reserve(count);
+    }
+
+    EntityHandle spawn(const T &value)
+    {
+        uint32_t slot;
+        if(freeHead != EntityHandle::INVALID_INDEX){
+            slot = freeHead;
+            freeHead = slots[slot].dense;
+        }
+        else{
+            slot = (uint32_t)slots.size();
+            slots.push_back(Slot());
+        }
+
+        slots[slot].dense = (uint32_t)items.size();
+        items.push_back(value);
+        owners.push_back(slot);
+
+        EntityHandle handle;
+        handle.index = slot;
+        handle.generation = slots[slot].generation;
+        return handle;
+    }
+
+    // false if the handle was already stale
+    bool destroy(EntityHandle handle)
+    {
+        if(!alive(handle))
+            return false;
+
+        Slot &slot = slots[handle.index];
+        uint32_t hole = slot.dense;
+        uint32_t last = (uint32_t)items.size() - 1;
+        if(hole != last){
+            items[hole] = items[last];
+            owners[hole] = owners[last];
+            slots[owners[hole]].dense = hole;
+        }
+        items.pop_back();
+        owners.pop_back();
+
+        // retire the slot: bump its generation so outstanding handles go
+        // stale, and reuse dense as the free list link
+        slot.generation += 1;
+        slot.dense = freeHead;
+        freeHead = handle.index;
+        return true;
+    }
+
+    bool alive(EntityHandle handle) const
+    {
+        return handle.index < slots.size() && slots[handle.index].generation == handle.generation;
+    }
+
+    // NULL for a stale handle
+    T* get(EntityHandle handle)
+    {
+        return alive(handle) ? &items[slots[handle.index].dense] : NULL;
+    }
+    const T* get(EntityHandle handle) const
+    {
+        return alive(handle) ? &items[slots[handle.index].dense] : NULL;
+    }
+
+    // destroy everything; every outstanding handle goes stale
+    void clear()
+    {
+        while(!items.empty()){
+            EntityHandle handle = handleAt(items.size() - 1);
+            destroy(handle);
+        }
+    }
+
+    // dense access, valid until the next spawn or destroy
+    size_t size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+    size_t capacity() const { return items.capacity(); }
+    T* data() { return items.data(); }
+    const T* data() const { return items.data(); }
+    T& operator[](size_t i) { return items[i]; }
+    const T& operator[](size_t i) const { return items[i]; }
+    T* begin() { return items.data(); }
+    T* end() { return items.data() + items.size(); }
+    const T* begin() const { return items.data(); }
+    const T* end() const { return items.data() + items.size(); }
+
+    // handle of the entity at dense position i
+    EntityHandle handleAt(size_t i) const
+    {
+        EntityHandle handle;
+        handle.index = owners[i];
+        handle.generation = slots[owners[i]].generation;
+        return handle;
+    }
+
+    struct Slot
+    {
+        uint32_t generation = 0;
+        // position in items while alive, next free slot once destroyed
+        uint32_t dense = EntityHandle::INVALID_INDEX;
+    };
+
+    // the pool's complete internal state, for snapshots (snapshot.h):
+    // restoring all of it brings back the same entities at the same dense
+    // positions, the same live and stale handles and the same order of
+    // slot reuse
+    const uint32_t* ownerData() const { return owners.data(); }
+    const Slot* slotData() const { return slots.data(); }
+    size_t slotCount() const { return slots.size(); }
+    uint32_t freeListHead() const { return freeHead; }
+
+    // counterpart of the accessors above; copies only, so a pool that has
+    // held this many entities before restores without allocating
+    // ------------------------------------------------------------------------
+    void restore(const T *values, const uint32_t *denseOwners, size_t count, const Slot *slotTable, size_t slotTableSize, uint32_t freeListHead)
+    {
+        items.assign(values, values + count);
+        owners.assign(denseOwners, denseOwners + count);
+        slots.assign(slotTable, slotTable + slotTableSize);
+        freeHead = freeListHead;
+    }
+
+private:
+    std::vector<T> items;
+    std::vector<uint32_t> owners;   // dense position -> slot
+    std::vector<Slot> slots;
+    uint32_t freeHead = EntityHandle::INVALID_INDEX;
+};
+
+#endif
@@ -0,0 +1,261 @@
+#ifndef FONTBAKE_H
+#define FONTBAKE_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <ft2build.h>
+#include <freetype/freetype.h>
+#include "character.h"
+
+// glyph metrics plus a single-channel signed distance field atlas: each
+// texel stores the distance to the glyph outline, 0.5 on the edge and
+// +-0.5 at spread pixels inside/outside. written to disk by fontcache.h so
+// the game only needs FreeType to bake
+// ------------------------------------------------------------------------
+struct FontAtlas
+{
+    int pixelSize = 0;
+    int lineHeight = 0;
+    int spread = 0;
+    int width = 0;
+    int height = 0;
+    std::vector<unsigned char> pixels;
+    Character glyphs[CHARACTER_COUNT];
+};
+
+// glyphs are rasterized this many times larger than the atlas, the distance
+// field computed at that resolution and averaged down
+const int SDF_SUPERSAMPLE = 4;
+
+// exact 1D squared euclidean distance transform (Felzenszwalb &
+// Huttenlocher) of f, in place over count samples spaced stride apart
+// ------------------------------------------------------------------------
+inline void distanceTransform1D(float *f, int count, int stride, std::vector<float> &d, std::vector<int> &v, std::vector<float> &z)
+{
+    const float INF = 1e20f;
+    d.resize(count);
+    v.resize(count);
+    z.resize(count + 1);
+
+    int k = 0;
+    v[0] = 0;
+    z[0] = -INF;
+    z[1] = INF;
+    for(int q = 1; q < count; q++){
+        float fq = f[q * stride] + (float)q * q;
+        int p = v[k];
+        float s = (fq - (f[p * stride] + (float)p * p)) / (2.0f * (q - p));
+        while(s <= z[k]){
+            k--;
+            p = v[k];
+            s = (fq - (f[p * stride] + (float)p * p)) / (2.0f * (q - p));
+        }
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = INF;
+    }
+
+    k = 0;
+    for(int q = 0; q < count; q++){
+        while(z[k + 1] < q)
+            k++;
+        int p = v[k];
+        d[q] = (float)(q - p) * (q - p) + f[p * stride];
+    }
+    for(int q = 0; q < count; q++)
+        f[q * stride] = d[q];
+}
+
+// squared distance from every pixel of a w x h grid to the nearest pixel
+// where seed is set (0 on the seeds themselves)
+// ------------------------------------------------------------------------
+inline void distanceTransform2D(const std::vector<bool> &seed, int w, int h, std::vector<float> &out)
+{
+    out.resize((size_t)w * h);
+    for(size_t i = 0; i < out.size(); i++)
+        out[i] = seed[i] ? 0.0f : 1e20f;
+
+    std::vector<float> d;
+    std::vector<int> v;
+    std::vector<float> z;
+    for(int x = 0; x < w; x++)
+        distanceTransform1D(&out[x], h, w, d, v, z);
+    for(int y = 0; y < h; y++)
+        distanceTransform1D(&out[(size_t)y * w], w, 1, d, v, z);
+}
+
+// turn the glyph FreeType just rendered (at SDF_SUPERSAMPLE times the atlas
+// size) into a distance field at atlas resolution with spread pixels of
+// margin; fills in the glyph's size and bearing at atlas resolution
+// ------------------------------------------------------------------------
+inline void glyphDistanceField(const FT_GlyphSlot glyph, int spread, std::vector<unsigned char> &field, Character &ch)
+{
+    const int S = SDF_SUPERSAMPLE;
+    const FT_Bitmap &bitmap = glyph->bitmap;
+    int left = glyph->bitmap_left;
+    int top = glyph->bitmap_top;
+    int w = (int)bitmap.width;
+    int h = (int)bitmap.rows;
+
+    // atlas-resolution box on a grid aligned to the pen origin, grown by
+    // spread on every side
+    int x0 = (int)std::floor((float)left / S) - spread;
+    int x1 = (int)std::ceil((float)(left + w) / S) + spread;
+    int y0 = (int)std::ceil((float)top / S) + spread;
+    int y1 = (int)std::floor((float)(top - h) / S) - spread;
+    int outW = x1 - x0;
+    int outH = y0 - y1;
+    ch.Size = glm::ivec2(outW, outH);
+    ch.Bearing = glm::ivec2(x0, y0);
+
+    // the same box at raster resolution, with the coverage thresholded into
+    // an inside/outside mask
+    int bigW = outW * S;
+    int bigH = outH * S;
+    int offsetX = left - x0 * S;
+    int offsetY = y0 * S - top;
+    std::vector<bool> inside((size_t)bigW * bigH, false);
+    std::vector<bool> outside((size_t)bigW * bigH, true);
+    for(int row = 0; row < h; row++){
+        for(int col = 0; col < w; col++){
+            if(bitmap.buffer[row * bitmap.pitch + col] < 128)
+                continue;
+            size_t i = (size_t)(row + offsetY) * bigW + (col + offsetX);
+            inside[i] = true;
+            outside[i] = false;
+        }
+    }
+
+    std::vector<float> toInside;
+    std::vector<float> toOutside;
+    distanceTransform2D(inside, bigW, bigH, toInside);
+    distanceTransform2D(outside, bigW, bigH, toOutside);
+
+    // signed distance per raster pixel (positive inside, edge halfway
+    // between pixel centres), averaged over each atlas texel
+    field.assign((size_t)outW * outH, 0);
+    for(int y = 0; y < outH; y++){
+        for(int x = 0; x < outW; x++){
+            float sum = 0.0f;
+            for(int sy = 0; sy < S; sy++){
+                for(int sx = 0; sx < S; sx++){
+                    size_t i = (size_t)(y * S + sy) * bigW + (x * S + sx);
+                    sum += inside[i] ? std::sqrt(toOutside[i]) - 0.5f : 0.5f - std::sqrt(toInside[i]);
+                }
+            }
+            float distance = sum / (S * S * S);
+            float value = 0.5f + distance / (2.0f * spread);
+            field[(size_t)y * outW + x] = (unsigned char)std::lround(std::min(std::max(value, 0.0f), 1.0f) * 255.0f);
+        }
+    }
+}
+
+// rasterize the first 128 ASCII glyphs of a font as distance fields and
+// pack them into a single atlas; glyphs records each glyph's metrics (at
+// pixelSize, boxes including the spread margin) and atlas rect
+// ------------------------------------------------------------------------
+inline bool bakeFontAtlas(const std::string &fontPath, int pixelSize, int spread, FontAtlas &out)
+{
+    FT_Library ft;
+
+    if(FT_Init_FreeType(&ft)){
+        std::cout << "ERROR::FREETYPE: Could not init FreeType library" << std::endl;
+        return false;
+    }
+
+    if (fontPath.empty())
+    {
+        std::cout << "ERROR::FREETYPE: No font file given" << std::endl;
+        FT_Done_FreeType(ft);
+        return false;
+    }
+
+    // load font as face
+    FT_Face face;
+    if (FT_New_Face(ft, fontPath.c_str(), 0, &face)) {
+        std::cout << "ERROR::FREETYPE: Failed to load font " << fontPath << std::endl;
+        FT_Done_FreeType(ft);
+        return false;
+    }
+
+    // rasterize large, the distance fields are scaled back down
+    FT_Set_Pixel_Sizes(face, 0, pixelSize * SDF_SUPERSAMPLE);
+    out.pixelSize = pixelSize;
+    out.spread = spread;
+    out.lineHeight = (int)std::lround((face->size->metrics.height / 64.0) / SDF_SUPERSAMPLE);
+
+    // first pass: build every glyph's field and shelf-pack it into rows of
+    // a fixed-width atlas. the spread margin already keeps linear filtering
+    // from bleeding into a neighbour; the extra pixel of padding keeps the
+    // neighbour's margin out of reach too
+    const int atlasWidth = 512;
+    const int padding = 1;
+    std::vector<unsigned char> fields[CHARACTER_COUNT];
+    glm::ivec2 offsets[CHARACTER_COUNT];
+    int penX = padding;
+    int penY = padding;
+    int rowHeight = 0;
+
+    for (unsigned char c = 0; c < CHARACTER_COUNT; c++)
+    {
+        out.glyphs[c] = Character();
+        offsets[c] = glm::ivec2(0);
+
+        // Load character glyph
+        if (FT_Load_Char(face, c, FT_LOAD_RENDER))
+        {
+            std::cout << "ERROR::FREETYTPE: Failed to load Glyph" << std::endl;
+            continue;
+        }
+        out.glyphs[c].Advance = static_cast<unsigned int>(face->glyph->advance.x / SDF_SUPERSAMPLE);
+
+        // blank glyphs (space, control codes) only need their advance
+        if(face->glyph->bitmap.width == 0 || face->glyph->bitmap.rows == 0)
+            continue;
+
+        glyphDistanceField(face->glyph, spread, fields[c], out.glyphs[c]);
+        int w = out.glyphs[c].Size.x;
+        int h = out.glyphs[c].Size.y;
+
+        if(penX + w + padding > atlasWidth){
+            penX = padding;
+            penY += rowHeight + padding;
+            rowHeight = 0;
+        }
+        offsets[c] = glm::ivec2(penX, penY);
+        penX += w + padding;
+        if(h > rowHeight)
+            rowHeight = h;
+    }
+
+    // destroy FreeType once we're finished
+    FT_Done_Face(face);
+    FT_Done_FreeType(ft);
+
+    // second pass: copy into the atlas, only as high as the rows need (GL
+    // 3.3 takes any texture size; a power of two would nearly double it)
+    int atlasHeight = (penY + rowHeight + padding + 3) & ~3;
+
+    out.width = atlasWidth;
+    out.height = atlasHeight;
+    out.pixels.assign((size_t)atlasWidth * atlasHeight, 0);
+    std::vector<unsigned char> &atlas = out.pixels;
+    for (int c = 0; c < CHARACTER_COUNT; c++)
+    {
+        Character &ch = out.glyphs[c];
+        for(int row = 0; row < ch.Size.y; row++)
+            memcpy(&atlas[(size_t)(offsets[c].y + row) * atlasWidth + offsets[c].x], &fields[c][(size_t)row * ch.Size.x], ch.Size.x);
+        ch.UVMin = glm::vec2((float)offsets[c].x / atlasWidth, (float)offsets[c].y / atlasHeight);
+        ch.UVMax = glm::vec2((float)(offsets[c].x + ch.Size.x) / atlasWidth, (float)(offsets[c].y + ch.Size.y) / atlasHeight);
+    }
+
+    return true;
+}
+
+#endif
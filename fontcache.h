@@ -0,0 +1,170 @@
+#ifndef FONTCACHE_H
+#define FONTCACHE_H
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "character.h"
+#include "mappedfile.h"
+
+// baked font file: a fixed header, CHARACTER_COUNT glyph records and the
+// distance field atlas, all little-endian and laid out so a mapped file can be
+// used in place. produced on first run (or by tools/bake_font) from a
+// FontAtlas, see fontbake.h. records the size and hash of the TrueType file
+// it was baked from, so replacing the font makes the cache stale
+// ------------------------------------------------------------------------
+struct FontCacheHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t pixelSize;
+    uint32_t characterCount;
+    uint32_t atlasWidth;
+    uint32_t atlasHeight;
+    int32_t lineHeight;
+    uint32_t spread;      // atlas pixels from the edge to distance 0 / 1
+    uint64_t sourceSize;  // of the TrueType file, see fontSourceStamp
+    uint64_t sourceHash;
+};
+
+struct FontCacheGlyph
+{
+    int32_t size[2];
+    int32_t bearing[2];
+    int32_t advance;     // 1/64 pixels, like FreeType
+    float uvMin[2];
+    float uvMax[2];
+};
+
+static_assert(sizeof(FontCacheHeader) == 48, "font cache header layout");
+static_assert(sizeof(FontCacheGlyph) == 36, "font cache glyph layout");
+
+const uint32_t FONT_CACHE_MAGIC = 0x4E465353; // "SSFN"
+const uint32_t FONT_CACHE_VERSION = 3; // 2: distance field atlas, 3: source font stamp
+
+// size and 64-bit FNV-1a hash of the font file a cache is baked from; false
+// if it cannot be read
+// ------------------------------------------------------------------------
+inline bool fontSourceStamp(const std::string &fontPath, uint64_t &size, uint64_t &hash)
+{
+    MappedFile font;
+    if(!font.open(fontPath))
+        return false;
+    const unsigned char *bytes = font.data();
+    size = font.size();
+    hash = 14695981039346656037ull;
+    for(size_t i = 0; i < font.size(); i++){
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return true;
+}
+
+// write a font baked from fontPath; returns false (file left untouched) on
+// any error
+// ------------------------------------------------------------------------
+inline bool writeFontCache(const std::string &path, const std::string &fontPath, int pixelSize, int lineHeight, int spread, const Character *glyphs,
+                           const unsigned char *pixels, int atlasWidth, int atlasHeight)
+{
+    FontCacheHeader header;
+    header.magic = FONT_CACHE_MAGIC;
+    header.version = FONT_CACHE_VERSION;
+    header.pixelSize = (uint32_t)pixelSize;
+    header.characterCount = (uint32_t)CHARACTER_COUNT;
+    header.atlasWidth = (uint32_t)atlasWidth;
+    header.atlasHeight = (uint32_t)atlasHeight;
+    header.lineHeight = lineHeight;
+    header.spread = (uint32_t)spread;
+    if(!fontSourceStamp(fontPath, header.sourceSize, header.sourceHash)){
+        std::cout << "ERROR::FONT_CACHE: Could not read " << fontPath << std::endl;
+        return false;
+    }
+
+    FontCacheGlyph records[CHARACTER_COUNT];
+    for(int c = 0; c < CHARACTER_COUNT; c++){
+        const Character &ch = glyphs[c];
+        FontCacheGlyph &record = records[c];
+        record.size[0] = ch.Size.x;
+        record.size[1] = ch.Size.y;
+        record.bearing[0] = ch.Bearing.x;
+        record.bearing[1] = ch.Bearing.y;
+        record.advance = (int32_t)ch.Advance;
+        record.uvMin[0] = ch.UVMin.x;
+        record.uvMin[1] = ch.UVMin.y;
+        record.uvMax[0] = ch.UVMax.x;
+        record.uvMax[1] = ch.UVMax.y;
+    }
+
+    size_t pixelBytes = (size_t)atlasWidth * atlasHeight;
+    std::vector<char> bytes(sizeof(header) + sizeof(records) + pixelBytes);
+    std::memcpy(&bytes[0], &header, sizeof(header));
+    std::memcpy(&bytes[sizeof(header)], records, sizeof(records));
+    std::memcpy(&bytes[sizeof(header) + sizeof(records)], pixels, pixelBytes);
+    return writeFileAtomically(path, bytes);
+}
+
+// a baked font mapped into memory; header(), glyph() and pixels() point
+// straight into the file
+// ------------------------------------------------------------------------
+class FontCacheFile
+{
+public:
+    // false if missing, truncated, from another format version, baked at
+    // a different pixel size or from a font other than fontPath. a missing
+    // fontPath is not checked against, so a build without FreeType can
+    // ship the cache alone
+    bool open(const std::string &path, int pixelSize, const std::string &fontPath)
+    {
+        if(!file.open(path))
+            return false;
+
+        size_t glyphBytes = sizeof(FontCacheGlyph) * CHARACTER_COUNT;
+        const FontCacheHeader *h = header();
+        bool valid = file.size() >= sizeof(FontCacheHeader)
+                  && h->magic == FONT_CACHE_MAGIC
+                  && h->version == FONT_CACHE_VERSION
+                  && h->pixelSize == (uint32_t)pixelSize
+                  && h->characterCount == (uint32_t)CHARACTER_COUNT
+                  && file.size() >= sizeof(FontCacheHeader) + glyphBytes + (size_t)h->atlasWidth * h->atlasHeight;
+        uint64_t sourceSize, sourceHash;
+        if(valid && fontSourceStamp(fontPath, sourceSize, sourceHash))
+            valid = h->sourceSize == sourceSize && h->sourceHash == sourceHash;
+        if(!valid)
+            file.close();
+        return valid;
+    }
+
+    const FontCacheHeader* header() const
+    {
+        return (const FontCacheHeader*)file.data();
+    }
+    const FontCacheGlyph* glyphs() const
+    {
+        return (const FontCacheGlyph*)(file.data() + sizeof(FontCacheHeader));
+    }
+    const unsigned char* pixels() const
+    {
+        return file.data() + sizeof(FontCacheHeader) + sizeof(FontCacheGlyph) * CHARACTER_COUNT;
+    }
+
+    // fill a Character table from the glyph records
+    void copyGlyphs(Character *out) const
+    {
+        const FontCacheGlyph *records = glyphs();
+        for(int c = 0; c < CHARACTER_COUNT; c++){
+            const FontCacheGlyph &record = records[c];
+            out[c].Size = glm::ivec2(record.size[0], record.size[1]);
+            out[c].Bearing = glm::ivec2(record.bearing[0], record.bearing[1]);
+            out[c].Advance = record.advance;
+            out[c].UVMin = glm::vec2(record.uvMin[0], record.uvMin[1]);
+            out[c].UVMax = glm::vec2(record.uvMax[0], record.uvMax[1]);
+        }
+    }
+
+private:
+    MappedFile file;
+};
+
+#endif
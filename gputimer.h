@@ -0,0 +1,174 @@
+#ifndef GPUTIMER_H
+#define GPUTIMER_H
+
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// GPU time of each render pass from GL_TIME_ELAPSED queries. every pass has
+// one query per frame in flight; a frame's results are collected when its
+// slot comes round again FRAMES_IN_FLIGHT frames later, and only if the GPU
+// already has them, so reading back never stalls the pipeline. contexts
+// without timer queries (the mock driver, some software rasterizers) report
+// zero counter bits and the pool turns itself off
+// ------------------------------------------------------------------------
+class GpuTimerPool
+{
+public:
+    static const int FRAMES_IN_FLIGHT = 3;
+    static const int MAX_PASSES = 8;
+    // rolling window the statistics are taken over
+    static const int WINDOW = 120;
+
+    struct PassStats
+    {
+        float minMs;
+        float avgMs;
+        float p99Ms;
+        int samples;
+    };
+
+    // requires a current GL context
+    // ------------------------------------------------------------------------
+    void init()
+    {
+        supported = false;
+        if(!GLAD_GL_VERSION_3_3 || glGenQueries == NULL || glGetQueryObjectui64v == NULL)
+            return;
+
+        GLint bits = 0;
+        glGetQueryiv(GL_TIME_ELAPSED, GL_QUERY_COUNTER_BITS, &bits);
+        if(bits <= 0)
+            return;
+
+        glGenQueries(FRAMES_IN_FLIGHT * MAX_PASSES, &queries[0][0]);
+        supported = true;
+    }
+
+    // register a pass before the first frame; returns its id for begin/end
+    int addPass(const char *name)
+    {
+        if(passCount == MAX_PASSES)
+            return -1;
+        passes[passCount].name = name;
+        return passCount++;
+    }
+
+    bool available() const { return supported; }
+
+    // move to the next slot, harvesting whatever it measured last time round
+    // ------------------------------------------------------------------------
+    void beginFrame()
+    {
+        if(!supported)
+            return;
+        frame += 1;
+        slot = (int)(frame % FRAMES_IN_FLIGHT);
+
+        for(int pass = 0; pass < passCount; pass++){
+            if(!pending[slot][pass])
+                continue;
+            pending[slot][pass] = false;
+
+            GLuint query = queries[slot][pass];
+            GLint ready = 0;
+            glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &ready);
+            if(!ready){
+                // still in flight after FRAMES_IN_FLIGHT frames; give up on it
+                // rather than wait, the query is simply restarted
+                passes[pass].dropped += 1;
+                continue;
+            }
+            GLuint64 nanoseconds = 0;
+            glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+            passes[pass].push((float)(nanoseconds / 1.0e6));
+        }
+    }
+
+    // bracket a pass; time-elapsed queries can't nest, so passes can't either
+    // ------------------------------------------------------------------------
+    void begin(int pass)
+    {
+        if(!supported || pass < 0)
+            return;
+        glBeginQuery(GL_TIME_ELAPSED, queries[slot][pass]);
+    }
+    void end(int pass)
+    {
+        if(!supported || pass < 0)
+            return;
+        glEndQuery(GL_TIME_ELAPSED);
+        pending[slot][pass] = true;
+    }
+
+    PassStats stats(int pass) const
+    {
+        const Pass &p = passes[pass];
+        PassStats result = { 0.0f, 0.0f, 0.0f, p.count };
+        if(p.count == 0)
+            return result;
+
+        float sorted[WINDOW];
+        std::copy(p.samples, p.samples + p.count, sorted);
+        std::sort(sorted, sorted + p.count);
+        float total = 0.0f;
+        for(int i = 0; i < p.count; i++)
+            total += sorted[i];
+        result.minMs = sorted[0];
+        result.avgMs = total / p.count;
+        result.p99Ms = sorted[(int)((p.count - 1) * 0.99f)];
+        return result;
+    }
+
+    // a header plus one line per pass ("TARGETS  0.010 / 0.012 / 0.020"),
+    // newline separated for RenderText
+    // ------------------------------------------------------------------------
+    void format(std::string &out) const
+    {
+        if(!supported){
+            out = "GPU MS - UNAVAILABLE";
+            return;
+        }
+        out = "GPU MS - MIN / AVG / P99";
+        char line[96];
+        for(int pass = 0; pass < passCount; pass++){
+            PassStats s = stats(pass);
+            if(s.samples == 0)
+                std::snprintf(line, sizeof(line), "\n%s  ...", passes[pass].name);
+            else
+                std::snprintf(line, sizeof(line), "\n%s  %.3f / %.3f / %.3f", passes[pass].name, s.minMs, s.avgMs, s.p99Ms);
+            out += line;
+        }
+    }
+
+private:
+    struct Pass
+    {
+        const char *name = "";
+        float samples[WINDOW];
+        int count = 0;
+        int next = 0;
+        unsigned int dropped = 0;
+
+        void push(float ms)
+        {
+            samples[next] = ms;
+            next = (next + 1) % WINDOW;
+            if(count < WINDOW)
+                count += 1;
+        }
+    };
+
+    bool supported = false;
+    uint64_t frame = 0;
+    int slot = 0;
+
+    GLuint queries[FRAMES_IN_FLIGHT][MAX_PASSES] = {};
+    bool pending[FRAMES_IN_FLIGHT][MAX_PASSES] = {};
+    Pass passes[MAX_PASSES];
+    int passCount = 0;
+};
+
+#endif
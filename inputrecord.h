@@ -0,0 +1,183 @@
+#ifndef INPUTRECORD_H
+#define INPUTRECORD_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "mappedfile.h"
+#include "world.h"
+
+// a game's inputs, one InputFrame::bits() per tick, run-length encoded: a
+// run is the input byte followed by its length in ticks as a LEB128
+// varint, so holding a key for a minute costs three bytes. stored with the
+// world seed and level hash the game started from and the state hash it
+// ended on, which is everything a replay needs to reproduce and check it
+//
+// file: header (below), then the runs. all values little-endian
+// ------------------------------------------------------------------------
+struct InputRecordingHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t seed;
+    uint64_t levelHash;
+    uint64_t tickCount;
+    uint64_t finalStateHash;
+    uint32_t tickRate;
+    uint32_t runBytes;
+};
+
+static_assert(sizeof(InputRecordingHeader) == 48, "input recording header layout");
+
+const uint32_t INPUT_RECORDING_MAGIC = 0x52495353; // "SSIR"
+const uint32_t INPUT_RECORDING_VERSION = 1;
+
+class InputRecording
+{
+public:
+    uint64_t seed = 0;
+    uint64_t levelHash = 0;
+    uint64_t tickCount = 0;
+    uint64_t finalStateHash = 0;
+    uint32_t tickRate = (uint32_t)SIM_TICK_RATE;
+
+    // start a recording of world, which has not been stepped yet
+    void begin(const World &world)
+    {
+        seed = world.seed;
+        levelHash = world.levelHash();
+        tickCount = 0;
+        finalStateHash = 0;
+        runs.clear();
+        currentBits = 0;
+        currentLength = 0;
+    }
+
+    // the input of the next tick
+    void record(const InputFrame &input)
+    {
+        uint8_t bits = input.bits();
+        if(currentLength > 0 && bits != currentBits)
+            flushRun();
+        currentBits = bits;
+        currentLength += 1;
+        tickCount += 1;
+    }
+
+    // close the recording on the world's current state
+    void end(const World &world)
+    {
+        flushRun();
+        finalStateHash = world.stateHash();
+    }
+
+    size_t encodedBytes() const { return runs.size(); }
+
+    // written whole or not at all (see writeFileAtomically)
+    bool save(const std::string &path) const
+    {
+        InputRecordingHeader header;
+        header.magic = INPUT_RECORDING_MAGIC;
+        header.version = INPUT_RECORDING_VERSION;
+        header.seed = seed;
+        header.levelHash = levelHash;
+        header.tickCount = tickCount;
+        header.finalStateHash = finalStateHash;
+        header.tickRate = tickRate;
+        header.runBytes = (uint32_t)runs.size();
+
+        std::vector<char> bytes(sizeof(header) + runs.size());
+        std::memcpy(&bytes[0], &header, sizeof(header));
+        if(!runs.empty())
+            std::memcpy(&bytes[sizeof(header)], runs.data(), runs.size());
+        return writeFileAtomically(path, bytes);
+    }
+
+    bool load(const std::string &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        InputRecordingHeader header;
+        if(!file || !file.read((char*)&header, sizeof(header)) || header.magic != INPUT_RECORDING_MAGIC){
+            std::cout << "ERROR::INPUT_RECORDING: " << path << " is not an input recording" << std::endl;
+            return false;
+        }
+        if(header.version != INPUT_RECORDING_VERSION){
+            std::cout << "ERROR::INPUT_RECORDING: " << path << " is version " << header.version << ", expected " << INPUT_RECORDING_VERSION << std::endl;
+            return false;
+        }
+        // the run length on disk must fit the file before it sizes anything
+        std::error_code error;
+        uintmax_t fileSize = std::filesystem::file_size(path, error);
+        if(error || header.runBytes > fileSize - sizeof(header)){
+            std::cout << "ERROR::INPUT_RECORDING: " << path << " is truncated" << std::endl;
+            return false;
+        }
+        runs.resize(header.runBytes);
+        if(!file.read((char*)runs.data(), (std::streamsize)runs.size())){
+            std::cout << "ERROR::INPUT_RECORDING: " << path << " is truncated" << std::endl;
+            return false;
+        }
+        seed = header.seed;
+        levelHash = header.levelHash;
+        tickCount = header.tickCount;
+        finalStateHash = header.finalStateHash;
+        tickRate = header.tickRate;
+        currentLength = 0;
+        return true;
+    }
+
+    // call visit(input, ticks) for each run in order; false if the runs are
+    // malformed or do not add up to tickCount
+    // ------------------------------------------------------------------------
+    template<typename Visit>
+    bool forEachRun(Visit visit) const
+    {
+        uint64_t ticks = 0;
+        size_t at = 0;
+        while(at < runs.size()){
+            uint8_t bits = runs[at++];
+            uint64_t length = 0;
+            int shift = 0;
+            for(;;){
+                if(at >= runs.size() || shift > 56)
+                    return false;
+                uint8_t byte = runs[at++];
+                length |= (uint64_t)(byte & 0x7F) << shift;
+                shift += 7;
+                if((byte & 0x80) == 0)
+                    break;
+            }
+            if(ticks + length > tickCount)
+                return false;
+            visit(InputFrame::fromBits(bits), length);
+            ticks += length;
+        }
+        return ticks == tickCount;
+    }
+
+private:
+    std::vector<uint8_t> runs;
+    uint8_t currentBits = 0;
+    uint64_t currentLength = 0;
+
+    void flushRun()
+    {
+        if(currentLength == 0)
+            return;
+        runs.push_back(currentBits);
+        uint64_t length = currentLength;
+        do{
+            uint8_t byte = (uint8_t)(length & 0x7F);
+            length >>= 7;
+            runs.push_back(length != 0 ? (uint8_t)(byte | 0x80) : byte);
+        } while(length != 0);
+        currentLength = 0;
+    }
+};
+
+#endif
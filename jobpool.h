@@ -0,0 +1,192 @@
+#ifndef JOBPOOL_H
+#define JOBPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// jobs one worker ran during the last run(), and how many of them it stole
+struct JobPoolWorkerStats
+{
+    uint64_t executed;
+    uint64_t stolen;
+};
+
+// fixed set of worker threads running index-based jobs with work stealing.
+// run() splits [0, count) into one contiguous range per worker; a worker
+// takes jobs from the front of its own range and, once that is empty,
+// steals the back half of another worker's range. uneven jobs (a game that
+// ends early, a level twice the size) therefore balance out without a
+// shared queue every job has to go through. the calling thread works as
+// worker 0, so a pool of one runs everything inline
+// ------------------------------------------------------------------------
+class JobPool
+{
+public:
+    // 0 uses every hardware thread
+    explicit JobPool(unsigned int threadCount = 0)
+    {
+        if(threadCount == 0)
+            threadCount = hardwareThreads();
+        queues.reset(new WorkerQueue[threadCount]);
+        workerStats.resize(threadCount);
+        for(unsigned int worker = 1; worker < threadCount; worker++)
+            threads.push_back(std::thread(&JobPool::workerLoop, this, worker));
+    }
+
+    ~JobPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for(std::thread &thread : threads)
+            thread.join();
+    }
+
+    JobPool(const JobPool&) = delete;
+    JobPool& operator=(const JobPool&) = delete;
+
+    unsigned int size() const { return (unsigned int)workerStats.size(); }
+
+    static unsigned int hardwareThreads()
+    {
+        unsigned int count = std::thread::hardware_concurrency();
+        return count > 0 ? count : 1;
+    }
+
+    // call job(index, worker) once for every index in [0, count) and return
+    // when all of them have finished. worker is in [0, size()), for
+    // per-worker scratch state
+    // ------------------------------------------------------------------------
+    void run(size_t count, const std::function<void(size_t, unsigned int)> &job)
+    {
+        unsigned int workers = size();
+        for(unsigned int worker = 0; worker < workers; worker++){
+            WorkerQueue &queue = queues[worker];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.begin = count * worker / workers;
+            queue.end = count * (worker + 1) / workers;
+            workerStats[worker].executed = 0;
+            workerStats[worker].stolen = 0;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            currentJob = &job;
+            busyWorkers = workers - 1;
+            epoch += 1;
+        }
+        wake.notify_all();
+
+        work(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this]{ return busyWorkers == 0; });
+        currentJob = NULL;
+    }
+
+    const JobPoolWorkerStats& stats(unsigned int worker) const { return workerStats[worker]; }
+
+private:
+    // the unclaimed part of one worker's jobs; padded so neighbouring
+    // workers' locks do not share a cache line
+    struct alignas(64) WorkerQueue
+    {
+        std::mutex mutex;
+        size_t begin = 0;
+        size_t end = 0;
+    };
+
+    std::unique_ptr<WorkerQueue[]> queues;
+    std::vector<JobPoolWorkerStats> workerStats;
+    std::vector<std::thread> threads;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(size_t, unsigned int)> *currentJob = NULL;
+    uint64_t epoch = 0;
+    unsigned int busyWorkers = 0;
+    bool stopping = false;
+
+    void workerLoop(unsigned int worker)
+    {
+        uint64_t seen = 0;
+        for(;;){
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [this, seen]{ return stopping || epoch != seen; });
+                if(stopping)
+                    return;
+                seen = epoch;
+            }
+
+            work(worker);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            busyWorkers -= 1;
+            if(busyWorkers == 0)
+                done.notify_all();
+        }
+    }
+
+    // run own jobs, then stolen ones, until no worker has any left
+    void work(unsigned int worker)
+    {
+        const std::function<void(size_t, unsigned int)> &job = *currentJob;
+        size_t index;
+        while(takeOwn(worker, index) || steal(worker, index)){
+            job(index, worker);
+            workerStats[worker].executed += 1;
+        }
+    }
+
+    bool takeOwn(unsigned int worker, size_t &index)
+    {
+        WorkerQueue &queue = queues[worker];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if(queue.begin == queue.end)
+            return false;
+        index = queue.begin++;
+        return true;
+    }
+
+    // move the back half of the first non-empty victim's range into our own
+    // (empty) range and hand out its first job
+    // ------------------------------------------------------------------------
+    bool steal(unsigned int worker, size_t &index)
+    {
+        unsigned int workers = size();
+        for(unsigned int offset = 1; offset < workers; offset++){
+            WorkerQueue &victim = queues[(worker + offset) % workers];
+            size_t begin, end;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                size_t available = victim.end - victim.begin;
+                if(available == 0)
+                    continue;
+                begin = victim.end - (available + 1) / 2;
+                end = victim.end;
+                victim.end = begin;
+            }
+
+            WorkerQueue &own = queues[worker];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            index = begin;
+            own.begin = begin + 1;
+            own.end = end;
+            workerStats[worker].stolen += end - begin;
+            return true;
+        }
+        return false;
+    }
+};
+
+#endif
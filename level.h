@@ -0,0 +1,180 @@
+#ifndef LEVEL_H
+#define LEVEL_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "mappedfile.h"
+#include "targetfield.h"
+
+// binary level file: a fixed header followed by the target arrays exactly
+// as TargetField stores them (SoA, padded to TargetField::LANES, active as
+// a bitset of 32-bit words), each section 32-byte aligned. loading maps the
+// file and bulk-copies the sections, so a level of a million targets loads
+// in a few milliseconds. all values little-endian
+//
+//   x        float[padded]      centres
+//   y        float[padded]
+//   size     float[padded]      edge length; only 1.0 (TargetField's fixed
+//                               extent) is accepted for now
+//   hits     uint8[padded]      hit points, 1 = breaks on first hit
+//   active   uint32[words]      alive at level start
+// ------------------------------------------------------------------------
+struct LevelHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t targetCount;
+    uint32_t paddedCount;
+    uint64_t xOffset;
+    uint64_t yOffset;
+    uint64_t sizeOffset;
+    uint64_t hitPointsOffset;
+    uint64_t activeOffset;
+    uint64_t fileSize;
+};
+
+static_assert(sizeof(LevelHeader) == 64, "level header layout");
+
+const uint32_t LEVEL_MAGIC = 0x564C5353; // "SSLV"
+const uint32_t LEVEL_VERSION = 1;
+const uint64_t LEVEL_SECTION_ALIGNMENT = 32;
+
+inline uint64_t levelAlign(uint64_t offset)
+{
+    return (offset + LEVEL_SECTION_ALIGNMENT - 1) / LEVEL_SECTION_ALIGNMENT * LEVEL_SECTION_ALIGNMENT;
+}
+
+// section offsets and the file size for a level of count targets; false
+// if the padded count does not fit the header's 32 bits or the file would
+// not fit in memory. all in 64 bits, so a count near 2^32 cannot wrap
+// around to a small layout
+// ------------------------------------------------------------------------
+inline bool levelLayout(uint64_t count, LevelHeader &header)
+{
+    uint64_t padded = (count + TargetField::LANES - 1) / TargetField::LANES * TargetField::LANES;
+    if(padded > UINT32_MAX)
+        return false;
+    header = LevelHeader();
+    header.magic = LEVEL_MAGIC;
+    header.version = LEVEL_VERSION;
+    header.targetCount = (uint32_t)count;
+    header.paddedCount = (uint32_t)padded;
+    header.xOffset = levelAlign(sizeof(LevelHeader));
+    header.yOffset = levelAlign(header.xOffset + padded * sizeof(float));
+    header.sizeOffset = levelAlign(header.yOffset + padded * sizeof(float));
+    header.hitPointsOffset = levelAlign(header.sizeOffset + padded * sizeof(float));
+    header.activeOffset = levelAlign(header.hitPointsOffset + padded);
+    header.fileSize = header.activeOffset + (padded + 31) / 32 * sizeof(uint32_t);
+    return header.fileSize <= SIZE_MAX;
+}
+
+// write field as a level file (see writeFileAtomically); false on any error
+// ------------------------------------------------------------------------
+inline bool writeLevel(const std::string &path, const TargetField &field)
+{
+    LevelHeader header;
+    if(!levelLayout(field.size(), header)){
+        std::cout << "ERROR::LEVEL: " << field.size() << " targets do not fit in a level file" << std::endl;
+        return false;
+    }
+    std::vector<char> bytes((size_t)header.fileSize, 0);
+    size_t padded = header.paddedCount;
+    std::memcpy(&bytes[0], &header, sizeof(header));
+    std::memcpy(&bytes[(size_t)header.xOffset], field.x.data(), padded * sizeof(float));
+    std::memcpy(&bytes[(size_t)header.yOffset], field.y.data(), padded * sizeof(float));
+    std::vector<float> sizes(padded, 1.0f);
+    std::memcpy(&bytes[(size_t)header.sizeOffset], sizes.data(), padded * sizeof(float));
+    std::memcpy(&bytes[(size_t)header.hitPointsOffset], field.hitPoints.data(), padded);
+    std::memcpy(&bytes[(size_t)header.activeOffset], field.active.data(), (padded + 31) / 32 * sizeof(uint32_t));
+
+    return writeFileAtomically(path, bytes);
+}
+
+// map a level file and copy it into field; field is untouched on failure
+// ------------------------------------------------------------------------
+inline bool loadLevel(const std::string &path, TargetField &field)
+{
+    MappedFile file;
+    if(!file.open(path)){
+        std::cout << "ERROR::LEVEL: Could not open " << path << std::endl;
+        return false;
+    }
+    if(file.size() < sizeof(LevelHeader)){
+        std::cout << "ERROR::LEVEL: " << path << " is not a level file" << std::endl;
+        return false;
+    }
+
+    const LevelHeader *header = (const LevelHeader*)file.data();
+    if(header->magic != LEVEL_MAGIC || header->version != LEVEL_VERSION){
+        std::cout << "ERROR::LEVEL: " << path << " is not a version " << LEVEL_VERSION << " level file" << std::endl;
+        return false;
+    }
+    // the layout is fully determined by the count, so one comparison checks
+    // every offset against the file
+    LevelHeader expected;
+    if(!levelLayout(header->targetCount, expected) || std::memcmp(header, &expected, sizeof(expected)) != 0 || file.size() < header->fileSize){
+        std::cout << "ERROR::LEVEL: " << path << " is truncated or corrupt" << std::endl;
+        return false;
+    }
+
+    const float *sizes = (const float*)(file.data() + header->sizeOffset);
+    for(uint32_t i = 0; i < header->targetCount; i++){
+        if(sizes[i] != TargetField::HALF_EXTENT * 2.0f){
+            std::cout << "ERROR::LEVEL: " << path << ": target " << i << " has size " << sizes[i] << ", only " << TargetField::HALF_EXTENT * 2.0f << " is supported" << std::endl;
+            return false;
+        }
+    }
+
+    field.assign(header->targetCount,
+                 (const float*)(file.data() + header->xOffset),
+                 (const float*)(file.data() + header->yOffset),
+                 file.data() + header->hitPointsOffset,
+                 (const uint32_t*)(file.data() + header->activeOffset));
+    return true;
+}
+
+// text level: one target per line, "x y [hit points] [active 0/1]";
+// blank lines and anything after '#' are ignored
+// ------------------------------------------------------------------------
+inline bool parseLevelText(const std::string &path, TargetField &field)
+{
+    std::ifstream file(path);
+    if(!file){
+        std::cout << "ERROR::LEVEL: Could not open " << path << std::endl;
+        return false;
+    }
+
+    field.clear();
+    std::string line;
+    int lineNumber = 0;
+    while(std::getline(file, line)){
+        lineNumber++;
+        size_t comment = line.find('#');
+        if(comment != std::string::npos)
+            line.erase(comment);
+        std::istringstream stream(line);
+        std::vector<float> values;
+        float value;
+        while(stream >> value)
+            values.push_back(value);
+        if(values.empty() && stream.eof())
+            continue;
+
+        bool valid = stream.eof() && values.size() >= 2 && values.size() <= 4;
+        float hits = values.size() > 2 ? values[2] : 1.0f;
+        bool alive = values.size() > 3 ? values[3] != 0.0f : true;
+        if(!valid || hits != (float)(int)hits || hits < 1.0f || hits > 255.0f){
+            std::cout << "ERROR::LEVEL: " << path << ":" << lineNumber << ": expected \"x y [hit points 1-255] [active 0/1]\"" << std::endl;
+            return false;
+        }
+        field.add(values[0], values[1], alive, (uint8_t)hits);
+    }
+    return true;
+}
+
+#endif
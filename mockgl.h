@@ -0,0 +1,564 @@
+#ifndef MOCKGL_H
+#define MOCKGL_H
+
+#include <glad/glad.h>
+
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "mockglfunctions.h"
+
+// one id per GL entry point, in glad.h order
+// ------------------------------------------------------------------------
+#define MOCKGL_ENUM_ENTRY(name, proc) MockGL_##name,
+enum MockGLFunction
+{
+    MOCKGL_FUNCTIONS(MOCKGL_ENUM_ENTRY)
+    MOCKGL_FUNCTION_COUNT
+};
+#undef MOCKGL_ENUM_ENTRY
+
+// what a call costs the driver, roughly: the buckets a frame budget is set in
+enum MockGLCategory
+{
+    MOCKGL_OTHER,
+    MOCKGL_DRAW,
+    MOCKGL_UNIFORM,
+    MOCKGL_BIND,
+    MOCKGL_UPLOAD
+};
+
+// totals since the last MockGL::reset()
+// ------------------------------------------------------------------------
+struct MockGLCounters
+{
+    uint64_t calls = 0;
+    uint64_t draws = 0;
+    uint64_t instances = 0;
+    uint64_t uniforms = 0;
+    uint64_t binds = 0;
+    uint64_t uploads = 0;
+    uint64_t uploadBytes = 0;
+};
+
+// a single call on the timeline, nanoseconds after the last reset()
+struct MockGLEvent
+{
+    uint32_t function;
+    uint64_t nanoseconds;
+};
+
+// stand-in for a GL driver: hand MockGL::getProcAddress to gladLoadGLLoader
+// and every glad function pointer lands in a stub that only counts and
+// timestamps the call. enough state is faked for the renderer to start up:
+// a 3.3 version string, object names from glGen*/glCreate*, successful
+// compiles and links, and uniforms reflected from the GLSL source so
+// Shader::uniform() resolves the same handles as on a real driver
+// ------------------------------------------------------------------------
+class MockGL
+{
+public:
+    // set to false to keep only the counters
+    static inline bool recordTimeline = true;
+    static inline std::vector<MockGLEvent> timeline;
+
+    // GLADloadproc; returns NULL for names glad does not know
+    // ------------------------------------------------------------------------
+    static void* getProcAddress(const char *name)
+    {
+        static std::unordered_map<std::string, void*> procs = buildProcTable();
+        std::unordered_map<std::string, void*>::const_iterator found = procs.find(name);
+        return found == procs.end() ? NULL : found->second;
+    }
+
+    // clear counters and timeline; GL objects created so far stay alive
+    // ------------------------------------------------------------------------
+    static void reset()
+    {
+        totals = MockGLCounters();
+        for(int i = 0; i < MOCKGL_FUNCTION_COUNT; i++)
+            perFunction[i] = 0;
+        timeline.clear();
+        epoch = std::chrono::steady_clock::now();
+    }
+
+    static const MockGLCounters& counters() { return totals; }
+
+    static uint64_t calls(MockGLFunction function) { return perFunction[function]; }
+
+    static const char* name(uint32_t function)
+    {
+        static const char *names[MOCKGL_FUNCTION_COUNT + 1] = {
+#define MOCKGL_NAME_ENTRY(name, proc) #name,
+            MOCKGL_FUNCTIONS(MOCKGL_NAME_ENTRY)
+#undef MOCKGL_NAME_ENTRY
+            "unknown"
+        };
+        return names[function < (uint32_t)MOCKGL_FUNCTION_COUNT ? function : (uint32_t)MOCKGL_FUNCTION_COUNT];
+    }
+
+    // called by every stub
+    // ------------------------------------------------------------------------
+    static void record(int function)
+    {
+        perFunction[function] += 1;
+        totals.calls += 1;
+        switch(category(function))
+        {
+            case MOCKGL_DRAW: totals.draws += 1; break;
+            case MOCKGL_UNIFORM: totals.uniforms += 1; break;
+            case MOCKGL_BIND: totals.binds += 1; break;
+            case MOCKGL_UPLOAD: totals.uploads += 1; break;
+            default: break;
+        }
+        if(recordTimeline){
+            MockGLEvent event;
+            event.function = (uint32_t)function;
+            event.nanoseconds = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+            timeline.push_back(event);
+        }
+    }
+
+    // bucket of a function, decided once from its name
+    // ------------------------------------------------------------------------
+    static MockGLCategory category(int function)
+    {
+        static std::vector<MockGLCategory> categories = buildCategories();
+        return categories[function];
+    }
+
+private:
+    // a linked program as the mock sees it: uniforms in declaration order,
+    // their index doubling as the location
+    struct MockUniform
+    {
+        std::string name;
+        GLenum type;
+        GLint size;
+    };
+    struct MockProgram
+    {
+        std::vector<GLuint> shaders;
+        std::vector<MockUniform> uniforms;
+        std::vector<std::string> blocks;
+    };
+
+    static inline MockGLCounters totals;
+    static inline uint64_t perFunction[MOCKGL_FUNCTION_COUNT] = {};
+    static inline std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+    static inline GLuint nextName = 1;
+    static inline std::map<GLuint, std::string> shaderSources;
+    static inline std::map<GLuint, MockProgram> programs;
+    static inline std::vector<unsigned char> mapScratch;
+
+    // generic stub: record the call, return zero of whatever type
+    // ------------------------------------------------------------------------
+    template <int Function, typename Proc> struct Stub;
+    template <int Function, typename R, typename... Args>
+    struct Stub<Function, R (APIENTRY *)(Args...)>
+    {
+        static R APIENTRY call(Args...)
+        {
+            record(Function);
+            return R();
+        }
+    };
+
+    static std::unordered_map<std::string, void*> buildProcTable()
+    {
+        std::unordered_map<std::string, void*> procs;
+#define MOCKGL_PROC_ENTRY(name, proc) procs[#name] = reinterpret_cast<void*>(&Stub<MockGL_##name, proc>::call);
+        MOCKGL_FUNCTIONS(MOCKGL_PROC_ENTRY)
+#undef MOCKGL_PROC_ENTRY
+
+        // calls whose results the renderer depends on
+        procs["glGetString"] = reinterpret_cast<void*>(&getString);
+        procs["glGetStringi"] = reinterpret_cast<void*>(&getStringi);
+        procs["glGetIntegerv"] = reinterpret_cast<void*>(&getIntegerv);
+        procs["glGenBuffers"] = reinterpret_cast<void*>(&genBuffers);
+        procs["glGenVertexArrays"] = reinterpret_cast<void*>(&genVertexArrays);
+        procs["glGenTextures"] = reinterpret_cast<void*>(&genTextures);
+        procs["glGenQueries"] = reinterpret_cast<void*>(&genQueries);
+        procs["glGenFramebuffers"] = reinterpret_cast<void*>(&genFramebuffers);
+        procs["glGenRenderbuffers"] = reinterpret_cast<void*>(&genRenderbuffers);
+        procs["glCheckFramebufferStatus"] = reinterpret_cast<void*>(&checkFramebufferStatus);
+        procs["glCreateShader"] = reinterpret_cast<void*>(&createShader);
+        procs["glCreateProgram"] = reinterpret_cast<void*>(&createProgram);
+        procs["glShaderSource"] = reinterpret_cast<void*>(&shaderSource);
+        procs["glAttachShader"] = reinterpret_cast<void*>(&attachShader);
+        procs["glLinkProgram"] = reinterpret_cast<void*>(&linkProgram);
+        procs["glGetShaderiv"] = reinterpret_cast<void*>(&getShaderiv);
+        procs["glGetProgramiv"] = reinterpret_cast<void*>(&getProgramiv);
+        procs["glGetShaderInfoLog"] = reinterpret_cast<void*>(&getShaderInfoLog);
+        procs["glGetProgramInfoLog"] = reinterpret_cast<void*>(&getProgramInfoLog);
+        procs["glGetActiveUniform"] = reinterpret_cast<void*>(&getActiveUniform);
+        procs["glGetUniformLocation"] = reinterpret_cast<void*>(&getUniformLocation);
+        procs["glGetUniformBlockIndex"] = reinterpret_cast<void*>(&getUniformBlockIndex);
+        procs["glBufferData"] = reinterpret_cast<void*>(&bufferData);
+        procs["glBufferSubData"] = reinterpret_cast<void*>(&bufferSubData);
+        procs["glTexImage2D"] = reinterpret_cast<void*>(&texImage2D);
+        procs["glTexSubImage2D"] = reinterpret_cast<void*>(&texSubImage2D);
+        procs["glMapBufferRange"] = reinterpret_cast<void*>(&mapBufferRange);
+        procs["glDrawArraysInstanced"] = reinterpret_cast<void*>(&drawArraysInstanced);
+        procs["glDrawElementsInstanced"] = reinterpret_cast<void*>(&drawElementsInstanced);
+        return procs;
+    }
+
+    static std::vector<MockGLCategory> buildCategories()
+    {
+        std::vector<MockGLCategory> categories(MOCKGL_FUNCTION_COUNT, MOCKGL_OTHER);
+        for(int i = 0; i < MOCKGL_FUNCTION_COUNT; i++){
+            std::string fn = name((uint32_t)i);
+            if(fn.compare(0, 6, "glDraw") == 0 || fn.compare(0, 11, "glMultiDraw") == 0)
+                categories[i] = MOCKGL_DRAW;
+            else if(fn.compare(0, 9, "glUniform") == 0 && fn != "glUniformBlockBinding")
+                categories[i] = MOCKGL_UNIFORM;
+            else if(fn.compare(0, 6, "glBind") == 0 || fn == "glUseProgram" || fn == "glActiveTexture")
+                categories[i] = MOCKGL_BIND;
+            else if(fn == "glBufferData" || fn == "glBufferSubData" || fn.compare(0, 10, "glTexImage") == 0 || fn.compare(0, 13, "glTexSubImage") == 0)
+                categories[i] = MOCKGL_UPLOAD;
+        }
+        return categories;
+    }
+
+    // driver identity; glad reads the version through glGetString and the
+    // extension list through GL_NUM_EXTENSIONS/glGetStringi
+    // ------------------------------------------------------------------------
+    static const GLubyte* APIENTRY getString(GLenum name)
+    {
+        record(MockGL_glGetString);
+        switch(name)
+        {
+            case GL_VERSION: return (const GLubyte*)"3.3.0 Mock";
+            case GL_VENDOR: return (const GLubyte*)"Shape-Shift";
+            case GL_RENDERER: return (const GLubyte*)"MockGL call recorder";
+            case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte*)"3.30";
+            default: return (const GLubyte*)"";
+        }
+    }
+    static const GLubyte* APIENTRY getStringi(GLenum name, GLuint index)
+    {
+        record(MockGL_glGetStringi);
+        if(name == GL_EXTENSIONS && index == 0)
+            return (const GLubyte*)"GL_MOCK_call_recorder";
+        return NULL;
+    }
+    static void APIENTRY getIntegerv(GLenum pname, GLint *data)
+    {
+        record(MockGL_glGetIntegerv);
+        switch(pname)
+        {
+            // glad treats an empty extension list as a failed load
+            case GL_NUM_EXTENSIONS: *data = 1; break;
+            case GL_MAJOR_VERSION: *data = 3; break;
+            case GL_MINOR_VERSION: *data = 3; break;
+            case GL_MAX_TEXTURE_SIZE: *data = 16384; break;
+            case GL_MAX_TEXTURE_BUFFER_SIZE: *data = 1 << 27; break;
+            case GL_MAX_UNIFORM_BUFFER_BINDINGS: *data = 36; break;
+            case GL_MAX_VERTEX_ATTRIBS: *data = 16; break;
+            default: *data = 0; break;
+        }
+    }
+
+    // object names: one counter for every kind, never reused
+    // ------------------------------------------------------------------------
+    static void generate(GLsizei n, GLuint *names)
+    {
+        for(GLsizei i = 0; i < n; i++)
+            names[i] = nextName++;
+    }
+    static void APIENTRY genBuffers(GLsizei n, GLuint *names) { record(MockGL_glGenBuffers); generate(n, names); }
+    static void APIENTRY genVertexArrays(GLsizei n, GLuint *names) { record(MockGL_glGenVertexArrays); generate(n, names); }
+    static void APIENTRY genTextures(GLsizei n, GLuint *names) { record(MockGL_glGenTextures); generate(n, names); }
+    static void APIENTRY genQueries(GLsizei n, GLuint *names) { record(MockGL_glGenQueries); generate(n, names); }
+    static void APIENTRY genFramebuffers(GLsizei n, GLuint *names) { record(MockGL_glGenFramebuffers); generate(n, names); }
+    static void APIENTRY genRenderbuffers(GLsizei n, GLuint *names) { record(MockGL_glGenRenderbuffers); generate(n, names); }
+
+    static GLenum APIENTRY checkFramebufferStatus(GLenum)
+    {
+        record(MockGL_glCheckFramebufferStatus);
+        return GL_FRAMEBUFFER_COMPLETE;
+    }
+
+    // shaders always compile and link; the source is kept for reflection
+    // ------------------------------------------------------------------------
+    static GLuint APIENTRY createShader(GLenum)
+    {
+        record(MockGL_glCreateShader);
+        GLuint shader = nextName++;
+        shaderSources[shader] = std::string();
+        return shader;
+    }
+    static GLuint APIENTRY createProgram()
+    {
+        record(MockGL_glCreateProgram);
+        GLuint program = nextName++;
+        programs[program] = MockProgram();
+        return program;
+    }
+    static void APIENTRY shaderSource(GLuint shader, GLsizei count, const GLchar *const *strings, const GLint *lengths)
+    {
+        record(MockGL_glShaderSource);
+        std::string &source = shaderSources[shader];
+        source.clear();
+        for(GLsizei i = 0; i < count; i++){
+            if(lengths != NULL && lengths[i] >= 0)
+                source.append(strings[i], (size_t)lengths[i]);
+            else
+                source.append(strings[i]);
+        }
+    }
+    static void APIENTRY attachShader(GLuint program, GLuint shader)
+    {
+        record(MockGL_glAttachShader);
+        programs[program].shaders.push_back(shader);
+    }
+    static void APIENTRY linkProgram(GLuint program)
+    {
+        record(MockGL_glLinkProgram);
+        MockProgram &linked = programs[program];
+        linked.uniforms.clear();
+        linked.blocks.clear();
+        for(GLuint shader : linked.shaders)
+            reflect(shaderSources[shader], linked);
+    }
+    static void APIENTRY getShaderiv(GLuint, GLenum pname, GLint *params)
+    {
+        record(MockGL_glGetShaderiv);
+        *params = pname == GL_COMPILE_STATUS ? GL_TRUE : 0;
+    }
+    static void APIENTRY getProgramiv(GLuint program, GLenum pname, GLint *params)
+    {
+        record(MockGL_glGetProgramiv);
+        const MockProgram &linked = programs[program];
+        switch(pname)
+        {
+            case GL_LINK_STATUS: *params = GL_TRUE; break;
+            case GL_ACTIVE_UNIFORMS: *params = (GLint)linked.uniforms.size(); break;
+            case GL_ACTIVE_UNIFORM_BLOCKS: *params = (GLint)linked.blocks.size(); break;
+            case GL_ACTIVE_UNIFORM_MAX_LENGTH:
+            {
+                GLint longest = 0;
+                for(const MockUniform &uniform : linked.uniforms){
+                    GLint length = (GLint)uniform.name.size() + (uniform.size > 1 ? 3 : 0) + 1;
+                    if(length > longest)
+                        longest = length;
+                }
+                *params = longest;
+                break;
+            }
+            default: *params = 0; break;
+        }
+    }
+    static void APIENTRY getShaderInfoLog(GLuint, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+    {
+        record(MockGL_glGetShaderInfoLog);
+        if(length != NULL) *length = 0;
+        if(bufSize > 0) infoLog[0] = '\0';
+    }
+    static void APIENTRY getProgramInfoLog(GLuint, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+    {
+        record(MockGL_glGetProgramInfoLog);
+        if(length != NULL) *length = 0;
+        if(bufSize > 0) infoLog[0] = '\0';
+    }
+    static void APIENTRY getActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+    {
+        record(MockGL_glGetActiveUniform);
+        const MockProgram &linked = programs[program];
+        if(index >= linked.uniforms.size() || bufSize <= 0)
+            return;
+        const MockUniform &uniform = linked.uniforms[index];
+        std::string reported = uniform.size > 1 ? uniform.name + "[0]" : uniform.name;
+        GLsizei copied = (GLsizei)reported.size() < bufSize - 1 ? (GLsizei)reported.size() : bufSize - 1;
+        memcpy(name, reported.data(), (size_t)copied);
+        name[copied] = '\0';
+        if(length != NULL) *length = copied;
+        *size = uniform.size;
+        *type = uniform.type;
+    }
+    static GLint APIENTRY getUniformLocation(GLuint program, const GLchar *name)
+    {
+        record(MockGL_glGetUniformLocation);
+        std::string plain(name);
+        size_t bracket = plain.find('[');
+        if(bracket != std::string::npos)
+            plain.resize(bracket);
+        const MockProgram &linked = programs[program];
+        for(size_t i = 0; i < linked.uniforms.size(); i++)
+            if(linked.uniforms[i].name == plain)
+                return (GLint)i;
+        return -1;
+    }
+    static GLuint APIENTRY getUniformBlockIndex(GLuint program, const GLchar *name)
+    {
+        record(MockGL_glGetUniformBlockIndex);
+        const MockProgram &linked = programs[program];
+        for(size_t i = 0; i < linked.blocks.size(); i++)
+            if(linked.blocks[i] == name)
+                return (GLuint)i;
+        return GL_INVALID_INDEX;
+    }
+
+    // uploads: counted in bytes, data is dropped
+    // ------------------------------------------------------------------------
+    static void APIENTRY bufferData(GLenum, GLsizeiptr size, const void *data, GLenum)
+    {
+        record(MockGL_glBufferData);
+        if(data != NULL)
+            totals.uploadBytes += (uint64_t)size;
+    }
+    static void APIENTRY bufferSubData(GLenum, GLintptr, GLsizeiptr size, const void *)
+    {
+        record(MockGL_glBufferSubData);
+        totals.uploadBytes += (uint64_t)size;
+    }
+    static void APIENTRY texImage2D(GLenum, GLint, GLint, GLsizei width, GLsizei height, GLint, GLenum format, GLenum type, const void *pixels)
+    {
+        record(MockGL_glTexImage2D);
+        if(pixels != NULL)
+            totals.uploadBytes += (uint64_t)width * (uint64_t)height * pixelBytes(format, type);
+    }
+    static void APIENTRY texSubImage2D(GLenum, GLint, GLint, GLint, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *)
+    {
+        record(MockGL_glTexSubImage2D);
+        totals.uploadBytes += (uint64_t)width * (uint64_t)height * pixelBytes(format, type);
+    }
+    static void* APIENTRY mapBufferRange(GLenum, GLintptr, GLsizeiptr length, GLbitfield)
+    {
+        record(MockGL_glMapBufferRange);
+        if(mapScratch.size() < (size_t)length)
+            mapScratch.resize((size_t)length);
+        totals.uploadBytes += (uint64_t)length;
+        return mapScratch.data();
+    }
+    static uint64_t pixelBytes(GLenum format, GLenum type)
+    {
+        uint64_t components = 4;
+        switch(format)
+        {
+            case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: components = 1; break;
+            case GL_RG: case GL_RG_INTEGER: components = 2; break;
+            case GL_RGB: case GL_BGR: components = 3; break;
+            default: break;
+        }
+        switch(type)
+        {
+            case GL_UNSIGNED_BYTE: case GL_BYTE: return components;
+            case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: return components * 2;
+            default: return components * 4;
+        }
+    }
+
+    // instanced draws also add their instance count
+    // ------------------------------------------------------------------------
+    static void APIENTRY drawArraysInstanced(GLenum, GLint, GLsizei, GLsizei instancecount)
+    {
+        record(MockGL_glDrawArraysInstanced);
+        totals.instances += (uint64_t)instancecount;
+    }
+    static void APIENTRY drawElementsInstanced(GLenum, GLsizei, GLenum, const void *, GLsizei instancecount)
+    {
+        record(MockGL_glDrawElementsInstanced);
+        totals.instances += (uint64_t)instancecount;
+    }
+
+    // pull "uniform <type> <name>[n];" declarations and "uniform <Block> {"
+    // block names out of GLSL source; good enough for this repo's shaders
+    // ------------------------------------------------------------------------
+    static void reflect(const std::string &source, MockProgram &program)
+    {
+        std::vector<std::string> tokens = tokenize(source);
+        int depth = 0;
+        for(size_t i = 0; i < tokens.size(); i++){
+            if(tokens[i] == "{") { depth++; continue; }
+            if(tokens[i] == "}") { depth--; continue; }
+            if(depth != 0 || tokens[i] != "uniform" || i + 2 >= tokens.size())
+                continue;
+
+            size_t t = i + 1;
+            while(t < tokens.size() && (tokens[t] == "lowp" || tokens[t] == "mediump" || tokens[t] == "highp"))
+                t++;
+            if(t + 1 >= tokens.size())
+                break;
+            if(tokens[t + 1] == "{"){
+                addBlock(program, tokens[t]);
+                continue;
+            }
+
+            MockUniform uniform;
+            uniform.type = glslType(tokens[t]);
+            uniform.name = tokens[t + 1];
+            uniform.size = 1;
+            if(t + 4 < tokens.size() && tokens[t + 2] == "[")
+                uniform.size = std::atoi(tokens[t + 3].c_str());
+            addUniform(program, uniform);
+        }
+    }
+    static void addUniform(MockProgram &program, const MockUniform &uniform)
+    {
+        for(const MockUniform &existing : program.uniforms)
+            if(existing.name == uniform.name)
+                return;
+        program.uniforms.push_back(uniform);
+    }
+    static void addBlock(MockProgram &program, const std::string &block)
+    {
+        for(const std::string &existing : program.blocks)
+            if(existing == block)
+                return;
+        program.blocks.push_back(block);
+    }
+    static std::vector<std::string> tokenize(const std::string &source)
+    {
+        std::vector<std::string> tokens;
+        size_t i = 0;
+        while(i < source.size()){
+            char c = source[i];
+            if(c == '/' && i + 1 < source.size() && source[i + 1] == '/'){
+                while(i < source.size() && source[i] != '\n') i++;
+            }
+            else if(c == '/' && i + 1 < source.size() && source[i + 1] == '*'){
+                size_t end = source.find("*/", i + 2);
+                i = end == std::string::npos ? source.size() : end + 2;
+            }
+            else if(c == '#'){
+                while(i < source.size() && source[i] != '\n') i++;
+            }
+            else if(isalnum((unsigned char)c) || c == '_'){
+                size_t start = i;
+                while(i < source.size() && (isalnum((unsigned char)source[i]) || source[i] == '_')) i++;
+                tokens.push_back(source.substr(start, i - start));
+            }
+            else{
+                if(!isspace((unsigned char)c))
+                    tokens.push_back(std::string(1, c));
+                i++;
+            }
+        }
+        return tokens;
+    }
+    static GLenum glslType(const std::string &type)
+    {
+        static const std::map<std::string, GLenum> types = {
+            { "float", GL_FLOAT }, { "vec2", GL_FLOAT_VEC2 }, { "vec3", GL_FLOAT_VEC3 }, { "vec4", GL_FLOAT_VEC4 },
+            { "int", GL_INT }, { "ivec2", GL_INT_VEC2 }, { "ivec3", GL_INT_VEC3 }, { "ivec4", GL_INT_VEC4 },
+            { "uint", GL_UNSIGNED_INT }, { "bool", GL_BOOL },
+            { "mat2", GL_FLOAT_MAT2 }, { "mat3", GL_FLOAT_MAT3 }, { "mat4", GL_FLOAT_MAT4 },
+            { "sampler2D", GL_SAMPLER_2D }, { "sampler2DArray", GL_SAMPLER_2D_ARRAY }, { "samplerCube", GL_SAMPLER_CUBE },
+            { "samplerBuffer", GL_SAMPLER_BUFFER }, { "isamplerBuffer", GL_INT_SAMPLER_BUFFER }, { "usamplerBuffer", GL_UNSIGNED_INT_SAMPLER_BUFFER },
+        };
+        std::map<std::string, GLenum>::const_iterator found = types.find(type);
+        return found == types.end() ? GL_FLOAT : found->second;
+    }
+};
+
+#endif
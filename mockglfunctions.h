@@ -0,0 +1,735 @@
+#ifndef MOCKGLFUNCTIONS_H
+#define MOCKGLFUNCTIONS_H
+
+// every entry point declared in glad/glad.h as X(name, pointer type), used by
+// mockgl.h to stamp out one recording stub per function. regenerate with
+//   grep -oE "^GLAPI PFN[A-Z0-9_]+PROC glad_gl[A-Za-z0-9_]+;" dependencies/include/glad/glad.h
+// whenever glad is regenerated for a different GL version
+// ------------------------------------------------------------------------
+#define MOCKGL_FUNCTIONS(X) \
+    X(glCullFace, PFNGLCULLFACEPROC) \
+    X(glFrontFace, PFNGLFRONTFACEPROC) \
+    X(glHint, PFNGLHINTPROC) \
+    X(glLineWidth, PFNGLLINEWIDTHPROC) \
+    X(glPointSize, PFNGLPOINTSIZEPROC) \
+    X(glPolygonMode, PFNGLPOLYGONMODEPROC) \
+    X(glScissor, PFNGLSCISSORPROC) \
+    X(glTexParameterf, PFNGLTEXPARAMETERFPROC) \
+    X(glTexParameterfv, PFNGLTEXPARAMETERFVPROC) \
+    X(glTexParameteri, PFNGLTEXPARAMETERIPROC) \
+    X(glTexParameteriv, PFNGLTEXPARAMETERIVPROC) \
+    X(glTexImage1D, PFNGLTEXIMAGE1DPROC) \
+    X(glTexImage2D, PFNGLTEXIMAGE2DPROC) \
+    X(glDrawBuffer, PFNGLDRAWBUFFERPROC) \
+    X(glClear, PFNGLCLEARPROC) \
+    X(glClearColor, PFNGLCLEARCOLORPROC) \
+    X(glClearStencil, PFNGLCLEARSTENCILPROC) \
+    X(glClearDepth, PFNGLCLEARDEPTHPROC) \
+    X(glStencilMask, PFNGLSTENCILMASKPROC) \
+    X(glColorMask, PFNGLCOLORMASKPROC) \
+    X(glDepthMask, PFNGLDEPTHMASKPROC) \
+    X(glDisable, PFNGLDISABLEPROC) \
+    X(glEnable, PFNGLENABLEPROC) \
+    X(glFinish, PFNGLFINISHPROC) \
+    X(glFlush, PFNGLFLUSHPROC) \
+    X(glBlendFunc, PFNGLBLENDFUNCPROC) \
+    X(glLogicOp, PFNGLLOGICOPPROC) \
+    X(glStencilFunc, PFNGLSTENCILFUNCPROC) \
+    X(glStencilOp, PFNGLSTENCILOPPROC) \
+    X(glDepthFunc, PFNGLDEPTHFUNCPROC) \
+    X(glPixelStoref, PFNGLPIXELSTOREFPROC) \
+    X(glPixelStorei, PFNGLPIXELSTOREIPROC) \
+    X(glReadBuffer, PFNGLREADBUFFERPROC) \
+    X(glReadPixels, PFNGLREADPIXELSPROC) \
+    X(glGetBooleanv, PFNGLGETBOOLEANVPROC) \
+    X(glGetDoublev, PFNGLGETDOUBLEVPROC) \
+    X(glGetError, PFNGLGETERRORPROC) \
+    X(glGetFloatv, PFNGLGETFLOATVPROC) \
+    X(glGetIntegerv, PFNGLGETINTEGERVPROC) \
+    X(glGetString, PFNGLGETSTRINGPROC) \
+    X(glGetTexImage, PFNGLGETTEXIMAGEPROC) \
+    X(glGetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC) \
+    X(glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC) \
+    X(glGetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC) \
+    X(glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC) \
+    X(glIsEnabled, PFNGLISENABLEDPROC) \
+    X(glDepthRange, PFNGLDEPTHRANGEPROC) \
+    X(glViewport, PFNGLVIEWPORTPROC) \
+    X(glNewList, PFNGLNEWLISTPROC) \
+    X(glEndList, PFNGLENDLISTPROC) \
+    X(glCallList, PFNGLCALLLISTPROC) \
+    X(glCallLists, PFNGLCALLLISTSPROC) \
+    X(glDeleteLists, PFNGLDELETELISTSPROC) \
+    X(glGenLists, PFNGLGENLISTSPROC) \
+    X(glListBase, PFNGLLISTBASEPROC) \
+    X(glBegin, PFNGLBEGINPROC) \
+    X(glBitmap, PFNGLBITMAPPROC) \
+    X(glColor3b, PFNGLCOLOR3BPROC) \
+    X(glColor3bv, PFNGLCOLOR3BVPROC) \
+    X(glColor3d, PFNGLCOLOR3DPROC) \
+    X(glColor3dv, PFNGLCOLOR3DVPROC) \
+    X(glColor3f, PFNGLCOLOR3FPROC) \
+    X(glColor3fv, PFNGLCOLOR3FVPROC) \
+    X(glColor3i, PFNGLCOLOR3IPROC) \
+    X(glColor3iv, PFNGLCOLOR3IVPROC) \
+    X(glColor3s, PFNGLCOLOR3SPROC) \
+    X(glColor3sv, PFNGLCOLOR3SVPROC) \
+    X(glColor3ub, PFNGLCOLOR3UBPROC) \
+    X(glColor3ubv, PFNGLCOLOR3UBVPROC) \
+    X(glColor3ui, PFNGLCOLOR3UIPROC) \
+    X(glColor3uiv, PFNGLCOLOR3UIVPROC) \
+    X(glColor3us, PFNGLCOLOR3USPROC) \
+    X(glColor3usv, PFNGLCOLOR3USVPROC) \
+    X(glColor4b, PFNGLCOLOR4BPROC) \
+    X(glColor4bv, PFNGLCOLOR4BVPROC) \
+    X(glColor4d, PFNGLCOLOR4DPROC) \
+    X(glColor4dv, PFNGLCOLOR4DVPROC) \
+    X(glColor4f, PFNGLCOLOR4FPROC) \
+    X(glColor4fv, PFNGLCOLOR4FVPROC) \
+    X(glColor4i, PFNGLCOLOR4IPROC) \
+    X(glColor4iv, PFNGLCOLOR4IVPROC) \
+    X(glColor4s, PFNGLCOLOR4SPROC) \
+    X(glColor4sv, PFNGLCOLOR4SVPROC) \
+    X(glColor4ub, PFNGLCOLOR4UBPROC) \
+    X(glColor4ubv, PFNGLCOLOR4UBVPROC) \
+    X(glColor4ui, PFNGLCOLOR4UIPROC) \
+    X(glColor4uiv, PFNGLCOLOR4UIVPROC) \
+    X(glColor4us, PFNGLCOLOR4USPROC) \
+    X(glColor4usv, PFNGLCOLOR4USVPROC) \
+    X(glEdgeFlag, PFNGLEDGEFLAGPROC) \
+    X(glEdgeFlagv, PFNGLEDGEFLAGVPROC) \
+    X(glEnd, PFNGLENDPROC) \
+    X(glIndexd, PFNGLINDEXDPROC) \
+    X(glIndexdv, PFNGLINDEXDVPROC) \
+    X(glIndexf, PFNGLINDEXFPROC) \
+    X(glIndexfv, PFNGLINDEXFVPROC) \
+    X(glIndexi, PFNGLINDEXIPROC) \
+    X(glIndexiv, PFNGLINDEXIVPROC) \
+    X(glIndexs, PFNGLINDEXSPROC) \
+    X(glIndexsv, PFNGLINDEXSVPROC) \
+    X(glNormal3b, PFNGLNORMAL3BPROC) \
+    X(glNormal3bv, PFNGLNORMAL3BVPROC) \
+    X(glNormal3d, PFNGLNORMAL3DPROC) \
+    X(glNormal3dv, PFNGLNORMAL3DVPROC) \
+    X(glNormal3f, PFNGLNORMAL3FPROC) \
+    X(glNormal3fv, PFNGLNORMAL3FVPROC) \
+    X(glNormal3i, PFNGLNORMAL3IPROC) \
+    X(glNormal3iv, PFNGLNORMAL3IVPROC) \
+    X(glNormal3s, PFNGLNORMAL3SPROC) \
+    X(glNormal3sv, PFNGLNORMAL3SVPROC) \
+    X(glRasterPos2d, PFNGLRASTERPOS2DPROC) \
+    X(glRasterPos2dv, PFNGLRASTERPOS2DVPROC) \
+    X(glRasterPos2f, PFNGLRASTERPOS2FPROC) \
+    X(glRasterPos2fv, PFNGLRASTERPOS2FVPROC) \
+    X(glRasterPos2i, PFNGLRASTERPOS2IPROC) \
+    X(glRasterPos2iv, PFNGLRASTERPOS2IVPROC) \
+    X(glRasterPos2s, PFNGLRASTERPOS2SPROC) \
+    X(glRasterPos2sv, PFNGLRASTERPOS2SVPROC) \
+    X(glRasterPos3d, PFNGLRASTERPOS3DPROC) \
+    X(glRasterPos3dv, PFNGLRASTERPOS3DVPROC) \
+    X(glRasterPos3f, PFNGLRASTERPOS3FPROC) \
+    X(glRasterPos3fv, PFNGLRASTERPOS3FVPROC) \
+    X(glRasterPos3i, PFNGLRASTERPOS3IPROC) \
+    X(glRasterPos3iv, PFNGLRASTERPOS3IVPROC) \
+    X(glRasterPos3s, PFNGLRASTERPOS3SPROC) \
+    X(glRasterPos3sv, PFNGLRASTERPOS3SVPROC) \
+    X(glRasterPos4d, PFNGLRASTERPOS4DPROC) \
+    X(glRasterPos4dv, PFNGLRASTERPOS4DVPROC) \
+    X(glRasterPos4f, PFNGLRASTERPOS4FPROC) \
+    X(glRasterPos4fv, PFNGLRASTERPOS4FVPROC) \
+    X(glRasterPos4i, PFNGLRASTERPOS4IPROC) \
+    X(glRasterPos4iv, PFNGLRASTERPOS4IVPROC) \
+    X(glRasterPos4s, PFNGLRASTERPOS4SPROC) \
+    X(glRasterPos4sv, PFNGLRASTERPOS4SVPROC) \
+    X(glRectd, PFNGLRECTDPROC) \
+    X(glRectdv, PFNGLRECTDVPROC) \
+    X(glRectf, PFNGLRECTFPROC) \
+    X(glRectfv, PFNGLRECTFVPROC) \
+    X(glRecti, PFNGLRECTIPROC) \
+    X(glRectiv, PFNGLRECTIVPROC) \
+    X(glRects, PFNGLRECTSPROC) \
+    X(glRectsv, PFNGLRECTSVPROC) \
+    X(glTexCoord1d, PFNGLTEXCOORD1DPROC) \
+    X(glTexCoord1dv, PFNGLTEXCOORD1DVPROC) \
+    X(glTexCoord1f, PFNGLTEXCOORD1FPROC) \
+    X(glTexCoord1fv, PFNGLTEXCOORD1FVPROC) \
+    X(glTexCoord1i, PFNGLTEXCOORD1IPROC) \
+    X(glTexCoord1iv, PFNGLTEXCOORD1IVPROC) \
+    X(glTexCoord1s, PFNGLTEXCOORD1SPROC) \
+    X(glTexCoord1sv, PFNGLTEXCOORD1SVPROC) \
+    X(glTexCoord2d, PFNGLTEXCOORD2DPROC) \
+    X(glTexCoord2dv, PFNGLTEXCOORD2DVPROC) \
+    X(glTexCoord2f, PFNGLTEXCOORD2FPROC) \
+    X(glTexCoord2fv, PFNGLTEXCOORD2FVPROC) \
+    X(glTexCoord2i, PFNGLTEXCOORD2IPROC) \
+    X(glTexCoord2iv, PFNGLTEXCOORD2IVPROC) \
+    X(glTexCoord2s, PFNGLTEXCOORD2SPROC) \
+    X(glTexCoord2sv, PFNGLTEXCOORD2SVPROC) \
+    X(glTexCoord3d, PFNGLTEXCOORD3DPROC) \
+    X(glTexCoord3dv, PFNGLTEXCOORD3DVPROC) \
+    X(glTexCoord3f, PFNGLTEXCOORD3FPROC) \
+    X(glTexCoord3fv, PFNGLTEXCOORD3FVPROC) \
+    X(glTexCoord3i, PFNGLTEXCOORD3IPROC) \
+    X(glTexCoord3iv, PFNGLTEXCOORD3IVPROC) \
+    X(glTexCoord3s, PFNGLTEXCOORD3SPROC) \
+    X(glTexCoord3sv, PFNGLTEXCOORD3SVPROC) \
+    X(glTexCoord4d, PFNGLTEXCOORD4DPROC) \
+    X(glTexCoord4dv, PFNGLTEXCOORD4DVPROC) \
+    X(glTexCoord4f, PFNGLTEXCOORD4FPROC) \
+    X(glTexCoord4fv, PFNGLTEXCOORD4FVPROC) \
+    X(glTexCoord4i, PFNGLTEXCOORD4IPROC) \
+    X(glTexCoord4iv, PFNGLTEXCOORD4IVPROC) \
+    X(glTexCoord4s, PFNGLTEXCOORD4SPROC) \
+    X(glTexCoord4sv, PFNGLTEXCOORD4SVPROC) \
+    X(glVertex2d, PFNGLVERTEX2DPROC) \
+    X(glVertex2dv, PFNGLVERTEX2DVPROC) \
+    X(glVertex2f, PFNGLVERTEX2FPROC) \
+    X(glVertex2fv, PFNGLVERTEX2FVPROC) \
+    X(glVertex2i, PFNGLVERTEX2IPROC) \
+    X(glVertex2iv, PFNGLVERTEX2IVPROC) \
+    X(glVertex2s, PFNGLVERTEX2SPROC) \
+    X(glVertex2sv, PFNGLVERTEX2SVPROC) \
+    X(glVertex3d, PFNGLVERTEX3DPROC) \
+    X(glVertex3dv, PFNGLVERTEX3DVPROC) \
+    X(glVertex3f, PFNGLVERTEX3FPROC) \
+    X(glVertex3fv, PFNGLVERTEX3FVPROC) \
+    X(glVertex3i, PFNGLVERTEX3IPROC) \
+    X(glVertex3iv, PFNGLVERTEX3IVPROC) \
+    X(glVertex3s, PFNGLVERTEX3SPROC) \
+    X(glVertex3sv, PFNGLVERTEX3SVPROC) \
+    X(glVertex4d, PFNGLVERTEX4DPROC) \
+    X(glVertex4dv, PFNGLVERTEX4DVPROC) \
+    X(glVertex4f, PFNGLVERTEX4FPROC) \
+    X(glVertex4fv, PFNGLVERTEX4FVPROC) \
+    X(glVertex4i, PFNGLVERTEX4IPROC) \
+    X(glVertex4iv, PFNGLVERTEX4IVPROC) \
+    X(glVertex4s, PFNGLVERTEX4SPROC) \
+    X(glVertex4sv, PFNGLVERTEX4SVPROC) \
+    X(glClipPlane, PFNGLCLIPPLANEPROC) \
+    X(glColorMaterial, PFNGLCOLORMATERIALPROC) \
+    X(glFogf, PFNGLFOGFPROC) \
+    X(glFogfv, PFNGLFOGFVPROC) \
+    X(glFogi, PFNGLFOGIPROC) \
+    X(glFogiv, PFNGLFOGIVPROC) \
+    X(glLightf, PFNGLLIGHTFPROC) \
+    X(glLightfv, PFNGLLIGHTFVPROC) \
+    X(glLighti, PFNGLLIGHTIPROC) \
+    X(glLightiv, PFNGLLIGHTIVPROC) \
+    X(glLightModelf, PFNGLLIGHTMODELFPROC) \
+    X(glLightModelfv, PFNGLLIGHTMODELFVPROC) \
+    X(glLightModeli, PFNGLLIGHTMODELIPROC) \
+    X(glLightModeliv, PFNGLLIGHTMODELIVPROC) \
+    X(glLineStipple, PFNGLLINESTIPPLEPROC) \
+    X(glMaterialf, PFNGLMATERIALFPROC) \
+    X(glMaterialfv, PFNGLMATERIALFVPROC) \
+    X(glMateriali, PFNGLMATERIALIPROC) \
+    X(glMaterialiv, PFNGLMATERIALIVPROC) \
+    X(glPolygonStipple, PFNGLPOLYGONSTIPPLEPROC) \
+    X(glShadeModel, PFNGLSHADEMODELPROC) \
+    X(glTexEnvf, PFNGLTEXENVFPROC) \
+    X(glTexEnvfv, PFNGLTEXENVFVPROC) \
+    X(glTexEnvi, PFNGLTEXENVIPROC) \
+    X(glTexEnviv, PFNGLTEXENVIVPROC) \
+    X(glTexGend, PFNGLTEXGENDPROC) \
+    X(glTexGendv, PFNGLTEXGENDVPROC) \
+    X(glTexGenf, PFNGLTEXGENFPROC) \
+    X(glTexGenfv, PFNGLTEXGENFVPROC) \
+    X(glTexGeni, PFNGLTEXGENIPROC) \
+    X(glTexGeniv, PFNGLTEXGENIVPROC) \
+    X(glFeedbackBuffer, PFNGLFEEDBACKBUFFERPROC) \
+    X(glSelectBuffer, PFNGLSELECTBUFFERPROC) \
+    X(glRenderMode, PFNGLRENDERMODEPROC) \
+    X(glInitNames, PFNGLINITNAMESPROC) \
+    X(glLoadName, PFNGLLOADNAMEPROC) \
+    X(glPassThrough, PFNGLPASSTHROUGHPROC) \
+    X(glPopName, PFNGLPOPNAMEPROC) \
+    X(glPushName, PFNGLPUSHNAMEPROC) \
+    X(glClearAccum, PFNGLCLEARACCUMPROC) \
+    X(glClearIndex, PFNGLCLEARINDEXPROC) \
+    X(glIndexMask, PFNGLINDEXMASKPROC) \
+    X(glAccum, PFNGLACCUMPROC) \
+    X(glPopAttrib, PFNGLPOPATTRIBPROC) \
+    X(glPushAttrib, PFNGLPUSHATTRIBPROC) \
+    X(glMap1d, PFNGLMAP1DPROC) \
+    X(glMap1f, PFNGLMAP1FPROC) \
+    X(glMap2d, PFNGLMAP2DPROC) \
+    X(glMap2f, PFNGLMAP2FPROC) \
+    X(glMapGrid1d, PFNGLMAPGRID1DPROC) \
+    X(glMapGrid1f, PFNGLMAPGRID1FPROC) \
+    X(glMapGrid2d, PFNGLMAPGRID2DPROC) \
+    X(glMapGrid2f, PFNGLMAPGRID2FPROC) \
+    X(glEvalCoord1d, PFNGLEVALCOORD1DPROC) \
+    X(glEvalCoord1dv, PFNGLEVALCOORD1DVPROC) \
+    X(glEvalCoord1f, PFNGLEVALCOORD1FPROC) \
+    X(glEvalCoord1fv, PFNGLEVALCOORD1FVPROC) \
+    X(glEvalCoord2d, PFNGLEVALCOORD2DPROC) \
+    X(glEvalCoord2dv, PFNGLEVALCOORD2DVPROC) \
+    X(glEvalCoord2f, PFNGLEVALCOORD2FPROC) \
+    X(glEvalCoord2fv, PFNGLEVALCOORD2FVPROC) \
+    X(glEvalMesh1, PFNGLEVALMESH1PROC) \
+    X(glEvalPoint1, PFNGLEVALPOINT1PROC) \
+    X(glEvalMesh2, PFNGLEVALMESH2PROC) \
+    X(glEvalPoint2, PFNGLEVALPOINT2PROC) \
+    X(glAlphaFunc, PFNGLALPHAFUNCPROC) \
+    X(glPixelZoom, PFNGLPIXELZOOMPROC) \
+    X(glPixelTransferf, PFNGLPIXELTRANSFERFPROC) \
+    X(glPixelTransferi, PFNGLPIXELTRANSFERIPROC) \
+    X(glPixelMapfv, PFNGLPIXELMAPFVPROC) \
+    X(glPixelMapuiv, PFNGLPIXELMAPUIVPROC) \
+    X(glPixelMapusv, PFNGLPIXELMAPUSVPROC) \
+    X(glCopyPixels, PFNGLCOPYPIXELSPROC) \
+    X(glDrawPixels, PFNGLDRAWPIXELSPROC) \
+    X(glGetClipPlane, PFNGLGETCLIPPLANEPROC) \
+    X(glGetLightfv, PFNGLGETLIGHTFVPROC) \
+    X(glGetLightiv, PFNGLGETLIGHTIVPROC) \
+    X(glGetMapdv, PFNGLGETMAPDVPROC) \
+    X(glGetMapfv, PFNGLGETMAPFVPROC) \
+    X(glGetMapiv, PFNGLGETMAPIVPROC) \
+    X(glGetMaterialfv, PFNGLGETMATERIALFVPROC) \
+    X(glGetMaterialiv, PFNGLGETMATERIALIVPROC) \
+    X(glGetPixelMapfv, PFNGLGETPIXELMAPFVPROC) \
+    X(glGetPixelMapuiv, PFNGLGETPIXELMAPUIVPROC) \
+    X(glGetPixelMapusv, PFNGLGETPIXELMAPUSVPROC) \
+    X(glGetPolygonStipple, PFNGLGETPOLYGONSTIPPLEPROC) \
+    X(glGetTexEnvfv, PFNGLGETTEXENVFVPROC) \
+    X(glGetTexEnviv, PFNGLGETTEXENVIVPROC) \
+    X(glGetTexGendv, PFNGLGETTEXGENDVPROC) \
+    X(glGetTexGenfv, PFNGLGETTEXGENFVPROC) \
+    X(glGetTexGeniv, PFNGLGETTEXGENIVPROC) \
+    X(glIsList, PFNGLISLISTPROC) \
+    X(glFrustum, PFNGLFRUSTUMPROC) \
+    X(glLoadIdentity, PFNGLLOADIDENTITYPROC) \
+    X(glLoadMatrixf, PFNGLLOADMATRIXFPROC) \
+    X(glLoadMatrixd, PFNGLLOADMATRIXDPROC) \
+    X(glMatrixMode, PFNGLMATRIXMODEPROC) \
+    X(glMultMatrixf, PFNGLMULTMATRIXFPROC) \
+    X(glMultMatrixd, PFNGLMULTMATRIXDPROC) \
+    X(glOrtho, PFNGLORTHOPROC) \
+    X(glPopMatrix, PFNGLPOPMATRIXPROC) \
+    X(glPushMatrix, PFNGLPUSHMATRIXPROC) \
+    X(glRotated, PFNGLROTATEDPROC) \
+    X(glRotatef, PFNGLROTATEFPROC) \
+    X(glScaled, PFNGLSCALEDPROC) \
+    X(glScalef, PFNGLSCALEFPROC) \
+    X(glTranslated, PFNGLTRANSLATEDPROC) \
+    X(glTranslatef, PFNGLTRANSLATEFPROC) \
+    X(glDrawArrays, PFNGLDRAWARRAYSPROC) \
+    X(glDrawElements, PFNGLDRAWELEMENTSPROC) \
+    X(glGetPointerv, PFNGLGETPOINTERVPROC) \
+    X(glPolygonOffset, PFNGLPOLYGONOFFSETPROC) \
+    X(glCopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC) \
+    X(glCopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC) \
+    X(glCopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC) \
+    X(glCopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC) \
+    X(glTexSubImage1D, PFNGLTEXSUBIMAGE1DPROC) \
+    X(glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC) \
+    X(glBindTexture, PFNGLBINDTEXTUREPROC) \
+    X(glDeleteTextures, PFNGLDELETETEXTURESPROC) \
+    X(glGenTextures, PFNGLGENTEXTURESPROC) \
+    X(glIsTexture, PFNGLISTEXTUREPROC) \
+    X(glArrayElement, PFNGLARRAYELEMENTPROC) \
+    X(glColorPointer, PFNGLCOLORPOINTERPROC) \
+    X(glDisableClientState, PFNGLDISABLECLIENTSTATEPROC) \
+    X(glEdgeFlagPointer, PFNGLEDGEFLAGPOINTERPROC) \
+    X(glEnableClientState, PFNGLENABLECLIENTSTATEPROC) \
+    X(glIndexPointer, PFNGLINDEXPOINTERPROC) \
+    X(glInterleavedArrays, PFNGLINTERLEAVEDARRAYSPROC) \
+    X(glNormalPointer, PFNGLNORMALPOINTERPROC) \
+    X(glTexCoordPointer, PFNGLTEXCOORDPOINTERPROC) \
+    X(glVertexPointer, PFNGLVERTEXPOINTERPROC) \
+    X(glAreTexturesResident, PFNGLARETEXTURESRESIDENTPROC) \
+    X(glPrioritizeTextures, PFNGLPRIORITIZETEXTURESPROC) \
+    X(glIndexub, PFNGLINDEXUBPROC) \
+    X(glIndexubv, PFNGLINDEXUBVPROC) \
+    X(glPopClientAttrib, PFNGLPOPCLIENTATTRIBPROC) \
+    X(glPushClientAttrib, PFNGLPUSHCLIENTATTRIBPROC) \
+    X(glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC) \
+    X(glTexImage3D, PFNGLTEXIMAGE3DPROC) \
+    X(glTexSubImage3D, PFNGLTEXSUBIMAGE3DPROC) \
+    X(glCopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC) \
+    X(glActiveTexture, PFNGLACTIVETEXTUREPROC) \
+    X(glSampleCoverage, PFNGLSAMPLECOVERAGEPROC) \
+    X(glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC) \
+    X(glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC) \
+    X(glCompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC) \
+    X(glCompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) \
+    X(glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) \
+    X(glCompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) \
+    X(glGetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC) \
+    X(glClientActiveTexture, PFNGLCLIENTACTIVETEXTUREPROC) \
+    X(glMultiTexCoord1d, PFNGLMULTITEXCOORD1DPROC) \
+    X(glMultiTexCoord1dv, PFNGLMULTITEXCOORD1DVPROC) \
+    X(glMultiTexCoord1f, PFNGLMULTITEXCOORD1FPROC) \
+    X(glMultiTexCoord1fv, PFNGLMULTITEXCOORD1FVPROC) \
+    X(glMultiTexCoord1i, PFNGLMULTITEXCOORD1IPROC) \
+    X(glMultiTexCoord1iv, PFNGLMULTITEXCOORD1IVPROC) \
+    X(glMultiTexCoord1s, PFNGLMULTITEXCOORD1SPROC) \
+    X(glMultiTexCoord1sv, PFNGLMULTITEXCOORD1SVPROC) \
+    X(glMultiTexCoord2d, PFNGLMULTITEXCOORD2DPROC) \
+    X(glMultiTexCoord2dv, PFNGLMULTITEXCOORD2DVPROC) \
+    X(glMultiTexCoord2f, PFNGLMULTITEXCOORD2FPROC) \
+    X(glMultiTexCoord2fv, PFNGLMULTITEXCOORD2FVPROC) \
+    X(glMultiTexCoord2i, PFNGLMULTITEXCOORD2IPROC) \
+    X(glMultiTexCoord2iv, PFNGLMULTITEXCOORD2IVPROC) \
+    X(glMultiTexCoord2s, PFNGLMULTITEXCOORD2SPROC) \
+    X(glMultiTexCoord2sv, PFNGLMULTITEXCOORD2SVPROC) \
+    X(glMultiTexCoord3d, PFNGLMULTITEXCOORD3DPROC) \
+    X(glMultiTexCoord3dv, PFNGLMULTITEXCOORD3DVPROC) \
+    X(glMultiTexCoord3f, PFNGLMULTITEXCOORD3FPROC) \
+    X(glMultiTexCoord3fv, PFNGLMULTITEXCOORD3FVPROC) \
+    X(glMultiTexCoord3i, PFNGLMULTITEXCOORD3IPROC) \
+    X(glMultiTexCoord3iv, PFNGLMULTITEXCOORD3IVPROC) \
+    X(glMultiTexCoord3s, PFNGLMULTITEXCOORD3SPROC) \
+    X(glMultiTexCoord3sv, PFNGLMULTITEXCOORD3SVPROC) \
+    X(glMultiTexCoord4d, PFNGLMULTITEXCOORD4DPROC) \
+    X(glMultiTexCoord4dv, PFNGLMULTITEXCOORD4DVPROC) \
+    X(glMultiTexCoord4f, PFNGLMULTITEXCOORD4FPROC) \
+    X(glMultiTexCoord4fv, PFNGLMULTITEXCOORD4FVPROC) \
+    X(glMultiTexCoord4i, PFNGLMULTITEXCOORD4IPROC) \
+    X(glMultiTexCoord4iv, PFNGLMULTITEXCOORD4IVPROC) \
+    X(glMultiTexCoord4s, PFNGLMULTITEXCOORD4SPROC) \
+    X(glMultiTexCoord4sv, PFNGLMULTITEXCOORD4SVPROC) \
+    X(glLoadTransposeMatrixf, PFNGLLOADTRANSPOSEMATRIXFPROC) \
+    X(glLoadTransposeMatrixd, PFNGLLOADTRANSPOSEMATRIXDPROC) \
+    X(glMultTransposeMatrixf, PFNGLMULTTRANSPOSEMATRIXFPROC) \
+    X(glMultTransposeMatrixd, PFNGLMULTTRANSPOSEMATRIXDPROC) \
+    X(glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC) \
+    X(glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC) \
+    X(glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC) \
+    X(glPointParameterf, PFNGLPOINTPARAMETERFPROC) \
+    X(glPointParameterfv, PFNGLPOINTPARAMETERFVPROC) \
+    X(glPointParameteri, PFNGLPOINTPARAMETERIPROC) \
+    X(glPointParameteriv, PFNGLPOINTPARAMETERIVPROC) \
+    X(glFogCoordf, PFNGLFOGCOORDFPROC) \
+    X(glFogCoordfv, PFNGLFOGCOORDFVPROC) \
+    X(glFogCoordd, PFNGLFOGCOORDDPROC) \
+    X(glFogCoorddv, PFNGLFOGCOORDDVPROC) \
+    X(glFogCoordPointer, PFNGLFOGCOORDPOINTERPROC) \
+    X(glSecondaryColor3b, PFNGLSECONDARYCOLOR3BPROC) \
+    X(glSecondaryColor3bv, PFNGLSECONDARYCOLOR3BVPROC) \
+    X(glSecondaryColor3d, PFNGLSECONDARYCOLOR3DPROC) \
+    X(glSecondaryColor3dv, PFNGLSECONDARYCOLOR3DVPROC) \
+    X(glSecondaryColor3f, PFNGLSECONDARYCOLOR3FPROC) \
+    X(glSecondaryColor3fv, PFNGLSECONDARYCOLOR3FVPROC) \
+    X(glSecondaryColor3i, PFNGLSECONDARYCOLOR3IPROC) \
+    X(glSecondaryColor3iv, PFNGLSECONDARYCOLOR3IVPROC) \
+    X(glSecondaryColor3s, PFNGLSECONDARYCOLOR3SPROC) \
+    X(glSecondaryColor3sv, PFNGLSECONDARYCOLOR3SVPROC) \
+    X(glSecondaryColor3ub, PFNGLSECONDARYCOLOR3UBPROC) \
+    X(glSecondaryColor3ubv, PFNGLSECONDARYCOLOR3UBVPROC) \
+    X(glSecondaryColor3ui, PFNGLSECONDARYCOLOR3UIPROC) \
+    X(glSecondaryColor3uiv, PFNGLSECONDARYCOLOR3UIVPROC) \
+    X(glSecondaryColor3us, PFNGLSECONDARYCOLOR3USPROC) \
+    X(glSecondaryColor3usv, PFNGLSECONDARYCOLOR3USVPROC) \
+    X(glSecondaryColorPointer, PFNGLSECONDARYCOLORPOINTERPROC) \
+    X(glWindowPos2d, PFNGLWINDOWPOS2DPROC) \
+    X(glWindowPos2dv, PFNGLWINDOWPOS2DVPROC) \
+    X(glWindowPos2f, PFNGLWINDOWPOS2FPROC) \
+    X(glWindowPos2fv, PFNGLWINDOWPOS2FVPROC) \
+    X(glWindowPos2i, PFNGLWINDOWPOS2IPROC) \
+    X(glWindowPos2iv, PFNGLWINDOWPOS2IVPROC) \
+    X(glWindowPos2s, PFNGLWINDOWPOS2SPROC) \
+    X(glWindowPos2sv, PFNGLWINDOWPOS2SVPROC) \
+    X(glWindowPos3d, PFNGLWINDOWPOS3DPROC) \
+    X(glWindowPos3dv, PFNGLWINDOWPOS3DVPROC) \
+    X(glWindowPos3f, PFNGLWINDOWPOS3FPROC) \
+    X(glWindowPos3fv, PFNGLWINDOWPOS3FVPROC) \
+    X(glWindowPos3i, PFNGLWINDOWPOS3IPROC) \
+    X(glWindowPos3iv, PFNGLWINDOWPOS3IVPROC) \
+    X(glWindowPos3s, PFNGLWINDOWPOS3SPROC) \
+    X(glWindowPos3sv, PFNGLWINDOWPOS3SVPROC) \
+    X(glBlendColor, PFNGLBLENDCOLORPROC) \
+    X(glBlendEquation, PFNGLBLENDEQUATIONPROC) \
+    X(glGenQueries, PFNGLGENQUERIESPROC) \
+    X(glDeleteQueries, PFNGLDELETEQUERIESPROC) \
+    X(glIsQuery, PFNGLISQUERYPROC) \
+    X(glBeginQuery, PFNGLBEGINQUERYPROC) \
+    X(glEndQuery, PFNGLENDQUERYPROC) \
+    X(glGetQueryiv, PFNGLGETQUERYIVPROC) \
+    X(glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC) \
+    X(glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC) \
+    X(glBindBuffer, PFNGLBINDBUFFERPROC) \
+    X(glDeleteBuffers, PFNGLDELETEBUFFERSPROC) \
+    X(glGenBuffers, PFNGLGENBUFFERSPROC) \
+    X(glIsBuffer, PFNGLISBUFFERPROC) \
+    X(glBufferData, PFNGLBUFFERDATAPROC) \
+    X(glBufferSubData, PFNGLBUFFERSUBDATAPROC) \
+    X(glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC) \
+    X(glMapBuffer, PFNGLMAPBUFFERPROC) \
+    X(glUnmapBuffer, PFNGLUNMAPBUFFERPROC) \
+    X(glGetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC) \
+    X(glGetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC) \
+    X(glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC) \
+    X(glDrawBuffers, PFNGLDRAWBUFFERSPROC) \
+    X(glStencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC) \
+    X(glStencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC) \
+    X(glStencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC) \
+    X(glAttachShader, PFNGLATTACHSHADERPROC) \
+    X(glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC) \
+    X(glCompileShader, PFNGLCOMPILESHADERPROC) \
+    X(glCreateProgram, PFNGLCREATEPROGRAMPROC) \
+    X(glCreateShader, PFNGLCREATESHADERPROC) \
+    X(glDeleteProgram, PFNGLDELETEPROGRAMPROC) \
+    X(glDeleteShader, PFNGLDELETESHADERPROC) \
+    X(glDetachShader, PFNGLDETACHSHADERPROC) \
+    X(glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC) \
+    X(glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC) \
+    X(glGetActiveAttrib, PFNGLGETACTIVEATTRIBPROC) \
+    X(glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC) \
+    X(glGetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC) \
+    X(glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC) \
+    X(glGetProgramiv, PFNGLGETPROGRAMIVPROC) \
+    X(glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC) \
+    X(glGetShaderiv, PFNGLGETSHADERIVPROC) \
+    X(glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC) \
+    X(glGetShaderSource, PFNGLGETSHADERSOURCEPROC) \
+    X(glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC) \
+    X(glGetUniformfv, PFNGLGETUNIFORMFVPROC) \
+    X(glGetUniformiv, PFNGLGETUNIFORMIVPROC) \
+    X(glGetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC) \
+    X(glGetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC) \
+    X(glGetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC) \
+    X(glGetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC) \
+    X(glIsProgram, PFNGLISPROGRAMPROC) \
+    X(glIsShader, PFNGLISSHADERPROC) \
+    X(glLinkProgram, PFNGLLINKPROGRAMPROC) \
+    X(glShaderSource, PFNGLSHADERSOURCEPROC) \
+    X(glUseProgram, PFNGLUSEPROGRAMPROC) \
+    X(glUniform1f, PFNGLUNIFORM1FPROC) \
+    X(glUniform2f, PFNGLUNIFORM2FPROC) \
+    X(glUniform3f, PFNGLUNIFORM3FPROC) \
+    X(glUniform4f, PFNGLUNIFORM4FPROC) \
+    X(glUniform1i, PFNGLUNIFORM1IPROC) \
+    X(glUniform2i, PFNGLUNIFORM2IPROC) \
+    X(glUniform3i, PFNGLUNIFORM3IPROC) \
+    X(glUniform4i, PFNGLUNIFORM4IPROC) \
+    X(glUniform1fv, PFNGLUNIFORM1FVPROC) \
+    X(glUniform2fv, PFNGLUNIFORM2FVPROC) \
+    X(glUniform3fv, PFNGLUNIFORM3FVPROC) \
+    X(glUniform4fv, PFNGLUNIFORM4FVPROC) \
+    X(glUniform1iv, PFNGLUNIFORM1IVPROC) \
+    X(glUniform2iv, PFNGLUNIFORM2IVPROC) \
+    X(glUniform3iv, PFNGLUNIFORM3IVPROC) \
+    X(glUniform4iv, PFNGLUNIFORM4IVPROC) \
+    X(glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC) \
+    X(glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC) \
+    X(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC) \
+    X(glValidateProgram, PFNGLVALIDATEPROGRAMPROC) \
+    X(glVertexAttrib1d, PFNGLVERTEXATTRIB1DPROC) \
+    X(glVertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC) \
+    X(glVertexAttrib1f, PFNGLVERTEXATTRIB1FPROC) \
+    X(glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC) \
+    X(glVertexAttrib1s, PFNGLVERTEXATTRIB1SPROC) \
+    X(glVertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC) \
+    X(glVertexAttrib2d, PFNGLVERTEXATTRIB2DPROC) \
+    X(glVertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC) \
+    X(glVertexAttrib2f, PFNGLVERTEXATTRIB2FPROC) \
+    X(glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC) \
+    X(glVertexAttrib2s, PFNGLVERTEXATTRIB2SPROC) \
+    X(glVertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC) \
+    X(glVertexAttrib3d, PFNGLVERTEXATTRIB3DPROC) \
+    X(glVertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC) \
+    X(glVertexAttrib3f, PFNGLVERTEXATTRIB3FPROC) \
+    X(glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC) \
+    X(glVertexAttrib3s, PFNGLVERTEXATTRIB3SPROC) \
+    X(glVertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC) \
+    X(glVertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC) \
+    X(glVertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC) \
+    X(glVertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC) \
+    X(glVertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC) \
+    X(glVertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC) \
+    X(glVertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC) \
+    X(glVertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC) \
+    X(glVertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC) \
+    X(glVertexAttrib4d, PFNGLVERTEXATTRIB4DPROC) \
+    X(glVertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC) \
+    X(glVertexAttrib4f, PFNGLVERTEXATTRIB4FPROC) \
+    X(glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC) \
+    X(glVertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC) \
+    X(glVertexAttrib4s, PFNGLVERTEXATTRIB4SPROC) \
+    X(glVertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC) \
+    X(glVertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC) \
+    X(glVertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC) \
+    X(glVertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC) \
+    X(glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC) \
+    X(glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC) \
+    X(glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC) \
+    X(glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC) \
+    X(glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC) \
+    X(glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC) \
+    X(glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC) \
+    X(glColorMaski, PFNGLCOLORMASKIPROC) \
+    X(glGetBooleani_v, PFNGLGETBOOLEANI_VPROC) \
+    X(glGetIntegeri_v, PFNGLGETINTEGERI_VPROC) \
+    X(glEnablei, PFNGLENABLEIPROC) \
+    X(glDisablei, PFNGLDISABLEIPROC) \
+    X(glIsEnabledi, PFNGLISENABLEDIPROC) \
+    X(glBeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC) \
+    X(glEndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC) \
+    X(glBindBufferRange, PFNGLBINDBUFFERRANGEPROC) \
+    X(glBindBufferBase, PFNGLBINDBUFFERBASEPROC) \
+    X(glTransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC) \
+    X(glGetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) \
+    X(glClampColor, PFNGLCLAMPCOLORPROC) \
+    X(glBeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC) \
+    X(glEndConditionalRender, PFNGLENDCONDITIONALRENDERPROC) \
+    X(glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC) \
+    X(glGetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC) \
+    X(glGetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC) \
+    X(glVertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC) \
+    X(glVertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC) \
+    X(glVertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC) \
+    X(glVertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC) \
+    X(glVertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC) \
+    X(glVertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC) \
+    X(glVertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC) \
+    X(glVertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC) \
+    X(glVertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC) \
+    X(glVertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC) \
+    X(glVertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC) \
+    X(glVertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC) \
+    X(glVertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC) \
+    X(glVertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC) \
+    X(glVertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC) \
+    X(glVertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC) \
+    X(glVertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC) \
+    X(glVertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC) \
+    X(glVertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC) \
+    X(glVertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC) \
+    X(glGetUniformuiv, PFNGLGETUNIFORMUIVPROC) \
+    X(glBindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC) \
+    X(glGetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC) \
+    X(glUniform1ui, PFNGLUNIFORM1UIPROC) \
+    X(glUniform2ui, PFNGLUNIFORM2UIPROC) \
+    X(glUniform3ui, PFNGLUNIFORM3UIPROC) \
+    X(glUniform4ui, PFNGLUNIFORM4UIPROC) \
+    X(glUniform1uiv, PFNGLUNIFORM1UIVPROC) \
+    X(glUniform2uiv, PFNGLUNIFORM2UIVPROC) \
+    X(glUniform3uiv, PFNGLUNIFORM3UIVPROC) \
+    X(glUniform4uiv, PFNGLUNIFORM4UIVPROC) \
+    X(glTexParameterIiv, PFNGLTEXPARAMETERIIVPROC) \
+    X(glTexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC) \
+    X(glGetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC) \
+    X(glGetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC) \
+    X(glClearBufferiv, PFNGLCLEARBUFFERIVPROC) \
+    X(glClearBufferuiv, PFNGLCLEARBUFFERUIVPROC) \
+    X(glClearBufferfv, PFNGLCLEARBUFFERFVPROC) \
+    X(glClearBufferfi, PFNGLCLEARBUFFERFIPROC) \
+    X(glGetStringi, PFNGLGETSTRINGIPROC) \
+    X(glIsRenderbuffer, PFNGLISRENDERBUFFERPROC) \
+    X(glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC) \
+    X(glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC) \
+    X(glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC) \
+    X(glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC) \
+    X(glGetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC) \
+    X(glIsFramebuffer, PFNGLISFRAMEBUFFERPROC) \
+    X(glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC) \
+    X(glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC) \
+    X(glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC) \
+    X(glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC) \
+    X(glFramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC) \
+    X(glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC) \
+    X(glFramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC) \
+    X(glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC) \
+    X(glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) \
+    X(glGenerateMipmap, PFNGLGENERATEMIPMAPPROC) \
+    X(glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC) \
+    X(glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) \
+    X(glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC) \
+    X(glMapBufferRange, PFNGLMAPBUFFERRANGEPROC) \
+    X(glFlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC) \
+    X(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC) \
+    X(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC) \
+    X(glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC) \
+    X(glIsVertexArray, PFNGLISVERTEXARRAYPROC) \
+    X(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC) \
+    X(glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC) \
+    X(glTexBuffer, PFNGLTEXBUFFERPROC) \
+    X(glPrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC) \
+    X(glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC) \
+    X(glGetUniformIndices, PFNGLGETUNIFORMINDICESPROC) \
+    X(glGetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC) \
+    X(glGetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC) \
+    X(glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC) \
+    X(glGetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC) \
+    X(glGetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) \
+    X(glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC) \
+    X(glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC) \
+    X(glDrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) \
+    X(glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) \
+    X(glMultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) \
+    X(glProvokingVertex, PFNGLPROVOKINGVERTEXPROC) \
+    X(glFenceSync, PFNGLFENCESYNCPROC) \
+    X(glIsSync, PFNGLISSYNCPROC) \
+    X(glDeleteSync, PFNGLDELETESYNCPROC) \
+    X(glClientWaitSync, PFNGLCLIENTWAITSYNCPROC) \
+    X(glWaitSync, PFNGLWAITSYNCPROC) \
+    X(glGetInteger64v, PFNGLGETINTEGER64VPROC) \
+    X(glGetSynciv, PFNGLGETSYNCIVPROC) \
+    X(glGetInteger64i_v, PFNGLGETINTEGER64I_VPROC) \
+    X(glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC) \
+    X(glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC) \
+    X(glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC) \
+    X(glTexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC) \
+    X(glGetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC) \
+    X(glSampleMaski, PFNGLSAMPLEMASKIPROC) \
+    X(glBindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) \
+    X(glGetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC) \
+    X(glGenSamplers, PFNGLGENSAMPLERSPROC) \
+    X(glDeleteSamplers, PFNGLDELETESAMPLERSPROC) \
+    X(glIsSampler, PFNGLISSAMPLERPROC) \
+    X(glBindSampler, PFNGLBINDSAMPLERPROC) \
+    X(glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC) \
+    X(glSamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC) \
+    X(glSamplerParameterf, PFNGLSAMPLERPARAMETERFPROC) \
+    X(glSamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC) \
+    X(glSamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC) \
+    X(glSamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC) \
+    X(glGetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC) \
+    X(glGetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC) \
+    X(glGetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC) \
+    X(glGetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC) \
+    X(glQueryCounter, PFNGLQUERYCOUNTERPROC) \
+    X(glGetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC) \
+    X(glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC) \
+    X(glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC) \
+    X(glVertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC) \
+    X(glVertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC) \
+    X(glVertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC) \
+    X(glVertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC) \
+    X(glVertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC) \
+    X(glVertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC) \
+    X(glVertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC) \
+    X(glVertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC) \
+    X(glVertexP2ui, PFNGLVERTEXP2UIPROC) \
+    X(glVertexP2uiv, PFNGLVERTEXP2UIVPROC) \
+    X(glVertexP3ui, PFNGLVERTEXP3UIPROC) \
+    X(glVertexP3uiv, PFNGLVERTEXP3UIVPROC) \
+    X(glVertexP4ui, PFNGLVERTEXP4UIPROC) \
+    X(glVertexP4uiv, PFNGLVERTEXP4UIVPROC) \
+    X(glTexCoordP1ui, PFNGLTEXCOORDP1UIPROC) \
+    X(glTexCoordP1uiv, PFNGLTEXCOORDP1UIVPROC) \
+    X(glTexCoordP2ui, PFNGLTEXCOORDP2UIPROC) \
+    X(glTexCoordP2uiv, PFNGLTEXCOORDP2UIVPROC) \
+    X(glTexCoordP3ui, PFNGLTEXCOORDP3UIPROC) \
+    X(glTexCoordP3uiv, PFNGLTEXCOORDP3UIVPROC) \
+    X(glTexCoordP4ui, PFNGLTEXCOORDP4UIPROC) \
+    X(glTexCoordP4uiv, PFNGLTEXCOORDP4UIVPROC) \
+    X(glMultiTexCoordP1ui, PFNGLMULTITEXCOORDP1UIPROC) \
+    X(glMultiTexCoordP1uiv, PFNGLMULTITEXCOORDP1UIVPROC) \
+    X(glMultiTexCoordP2ui, PFNGLMULTITEXCOORDP2UIPROC) \
+    X(glMultiTexCoordP2uiv, PFNGLMULTITEXCOORDP2UIVPROC) \
+    X(glMultiTexCoordP3ui, PFNGLMULTITEXCOORDP3UIPROC) \
+    X(glMultiTexCoordP3uiv, PFNGLMULTITEXCOORDP3UIVPROC) \
+    X(glMultiTexCoordP4ui, PFNGLMULTITEXCOORDP4UIPROC) \
+    X(glMultiTexCoordP4uiv, PFNGLMULTITEXCOORDP4UIVPROC) \
+    X(glNormalP3ui, PFNGLNORMALP3UIPROC) \
+    X(glNormalP3uiv, PFNGLNORMALP3UIVPROC) \
+    X(glColorP3ui, PFNGLCOLORP3UIPROC) \
+    X(glColorP3uiv, PFNGLCOLORP3UIVPROC) \
+    X(glColorP4ui, PFNGLCOLORP4UIPROC) \
+    X(glColorP4uiv, PFNGLCOLORP4UIVPROC) \
+    X(glSecondaryColorP3ui, PFNGLSECONDARYCOLORP3UIPROC) \
+    X(glSecondaryColorP3uiv, PFNGLSECONDARYCOLORP3UIVPROC) \
+
+#endif
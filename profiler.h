@@ -0,0 +1,191 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// scoped timing zones, exported as Chrome/Perfetto trace JSON. everything
+// here is compiled out unless SHAPE_SHIFT_PROFILE is defined (add
+// -DSHAPE_SHIFT_PROFILE to the build); without it the macros expand to
+// nothing.
+//
+//   PROFILE_ZONE("name");          time the rest of the enclosing scope
+//   PROFILE_THREAD("name");        label the calling thread in the trace
+//   PROFILE_EXPORT("trace.json");  write everything recorded so far
+//
+// zone and thread names must be string literals (only the pointer is kept)
+
+#ifdef SHAPE_SHIFT_PROFILE
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// one finished zone, times in nanoseconds since the profiler started
+struct ProfileEvent
+{
+    const char *name;
+    uint64_t start;
+    uint64_t end;
+};
+
+// fixed-size ring of the newest events of one thread. only the owning thread
+// writes; export reads from another thread without locking and drops
+// whatever the writer may have lapped while it was copying
+// ------------------------------------------------------------------------
+struct ProfileThreadBuffer
+{
+    static const uint64_t CAPACITY = 1 << 16;
+
+    ProfileEvent events[CAPACITY];
+    std::atomic<uint64_t> head{0};
+    uint32_t threadId = 0;
+    const char *threadName = nullptr;
+
+    void push(const ProfileEvent &event)
+    {
+        uint64_t index = head.load(std::memory_order_relaxed);
+        events[index & (CAPACITY - 1)] = event;
+        head.store(index + 1, std::memory_order_release);
+    }
+
+    // append a consistent copy of the events still in the ring
+    void snapshot(std::vector<ProfileEvent> &out) const
+    {
+        uint64_t end = head.load(std::memory_order_acquire);
+        uint64_t begin = end > CAPACITY ? end - CAPACITY : 0;
+        size_t first = out.size();
+        for(uint64_t i = begin; i < end; i++)
+            out.push_back(events[i & (CAPACITY - 1)]);
+        // anything the writer overwrote during the copy is unreliable, and
+        // so is index after itself: push() writes it before publishing
+        // after + 1, so its slot (that of after - CAPACITY) may be torn
+        uint64_t after = head.load(std::memory_order_acquire);
+        uint64_t valid = after + 1 > CAPACITY ? after + 1 - CAPACITY : 0;
+        if(valid > begin){
+            size_t dropped = (size_t)std::min<uint64_t>(valid - begin, end - begin);
+            out.erase(out.begin() + first, out.begin() + first + dropped);
+        }
+    }
+};
+
+class Profiler
+{
+public:
+    static uint64_t now()
+    {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+    }
+
+    // the calling thread's ring, created and registered on first use
+    // ------------------------------------------------------------------------
+    static ProfileThreadBuffer& threadBuffer()
+    {
+        thread_local ProfileThreadBuffer *buffer = registerThread();
+        return *buffer;
+    }
+
+    static void nameThread(const char *name)
+    {
+        threadBuffer().threadName = name;
+    }
+
+    // write every thread's events as a Chrome trace ("X" complete events,
+    // microsecond timestamps); open in chrome://tracing or ui.perfetto.dev
+    // ------------------------------------------------------------------------
+    static bool exportTrace(const char *path)
+    {
+        std::ofstream file(path);
+        if(!file){
+            std::cout << "ERROR::PROFILER: Could not write trace to " << path << std::endl;
+            return false;
+        }
+
+        std::vector<ProfileEvent> events;
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        bool first = true;
+        size_t written = 0;
+
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for(const std::unique_ptr<ProfileThreadBuffer> &buffer : buffers){
+            if(buffer->threadName != nullptr){
+                file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+                     << ",\"args\":{\"name\":\"" << buffer->threadName << "\"}}";
+                first = false;
+            }
+
+            events.clear();
+            buffer->snapshot(events);
+            for(const ProfileEvent &event : events){
+                file << (first ? "" : ",\n") << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId
+                     << ",\"ts\":" << event.start / 1000 << "." << (event.start % 1000) / 100
+                     << ",\"dur\":" << (event.end - event.start) / 1000 << "." << ((event.end - event.start) % 1000) / 100 << "}";
+                first = false;
+            }
+            written += events.size();
+        }
+        file << "\n]}\n";
+
+        std::cout << "PROFILER: wrote " << written << " events to " << path << std::endl;
+        return true;
+    }
+
+private:
+    static inline const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    static inline std::mutex registryMutex;
+    // owned here rather than by the thread so a trace can still be exported
+    // after a worker exits
+    static inline std::vector<std::unique_ptr<ProfileThreadBuffer> > buffers;
+
+    static ProfileThreadBuffer* registerThread()
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        buffers.emplace_back(new ProfileThreadBuffer());
+        buffers.back()->threadId = (uint32_t)buffers.size();
+        return buffers.back().get();
+    }
+};
+
+// records [construction, destruction) of itself as one event
+// ------------------------------------------------------------------------
+class ProfileZone
+{
+public:
+    explicit ProfileZone(const char *zoneName) : name(zoneName), start(Profiler::now()) {}
+
+    ~ProfileZone()
+    {
+        ProfileEvent event;
+        event.name = name;
+        event.start = start;
+        event.end = Profiler::now();
+        Profiler::threadBuffer().push(event);
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char *name;
+    uint64_t start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_THREAD(name) Profiler::nameThread(name)
+#define PROFILE_EXPORT(path) Profiler::exportTrace(path)
+
+#else
+
+#define PROFILE_ZONE(name) do {} while(0)
+#define PROFILE_THREAD(name) do {} while(0)
+#define PROFILE_EXPORT(path) do {} while(0)
+
+#endif
+
+#endif
@@ -0,0 +1,240 @@
+#ifndef PROGRAMCACHE_H
+#define PROGRAMCACHE_H
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "mappedfile.h"
+
+// program binaries are core in GL 4.1 (ARB_get_program_binary before that),
+// so the 3.3 glad in this repo has neither the enums nor the entry points
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+#ifndef GL_PROGRAM_BINARY_LENGTH
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+
+typedef void (APIENTRYP PFNPROGRAMBINARYPROC)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+typedef void (APIENTRYP PFNGETPROGRAMBINARYPROC)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+typedef void (APIENTRYP PFNPROGRAMPARAMETERIPROC)(GLuint program, GLenum pname, GLint value);
+
+// on-disk cache of linked programs. each entry is the driver's
+// glGetProgramBinary blob, stored under a hash of the shader sources plus
+// GL vendor, renderer and version, so a driver update or an edited shader
+// simply misses. entries unused for longest are evicted once there are
+// more than MAX_ENTRIES, so hot-reloaded edits do not pile up on disk. the
+// cache stays off (every Shader compiles from source)
+// until init() finds working entry points and at least one binary format
+// ------------------------------------------------------------------------
+class ProgramBinaryCache
+{
+public:
+    // loader is the same proc-address function handed to gladLoadGLLoader;
+    // call after glad is loaded and before the first Shader is built
+    // ------------------------------------------------------------------------
+    static bool init(GLADloadproc load, const std::string &cacheDirectory = "shader_cache")
+    {
+        enabled = false;
+        programBinary = (PFNPROGRAMBINARYPROC)load("glProgramBinary");
+        getProgramBinary = (PFNGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+        programParameteri = (PFNPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+        if(programBinary == NULL || getProgramBinary == NULL || programParameteri == NULL)
+            return false;
+
+        GLint formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        if(formats <= 0)
+            return false;
+
+        directory = cacheDirectory;
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        if(error){
+            std::cout << "ERROR::PROGRAM_CACHE: Could not create " << directory << ": " << error.message() << std::endl;
+            return false;
+        }
+
+        driverKey.clear();
+        const GLenum identity[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+        for(GLenum name : identity){
+            const GLubyte *value = glGetString(name);
+            if(value != NULL)
+                driverKey += (const char*)value;
+            driverKey += '\n';
+        }
+        enabled = true;
+        return true;
+    }
+
+    static bool isEnabled() { return enabled; }
+
+    // 64-bit FNV-1a over the sources and the driver identity
+    // ------------------------------------------------------------------------
+    static uint64_t key(const std::string &vertexCode, const std::string &fragmentCode, const std::string &geometryCode)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        const std::string *parts[] = { &vertexCode, &fragmentCode, &geometryCode, &driverKey };
+        for(const std::string *part : parts){
+            for(unsigned char c : *part){
+                hash ^= c;
+                hash *= 1099511628211ull;
+            }
+            // separator so moving text between stages changes the key
+            hash ^= 0xFF;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    // ask the driver to keep the binary of a program about to be linked
+    static void prepare(GLuint program)
+    {
+        if(enabled)
+            programParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    // link program from a cached binary; false (and the entry is removed) if
+    // there is none or the driver rejects it
+    // ------------------------------------------------------------------------
+    static bool load(uint64_t programKey, GLuint program)
+    {
+        if(!enabled)
+            return false;
+
+        std::string path = entryPath(programKey);
+        std::ifstream file(path, std::ios::binary);
+        if(!file){
+            misses += 1;
+            return false;
+        }
+
+        // the length on disk must fit the file (and so a GLsizei) before it
+        // sizes anything
+        std::error_code error;
+        uintmax_t fileSize = std::filesystem::file_size(path, error);
+        EntryHeader header;
+        std::vector<char> binary;
+        bool valid = !error && fileSize >= sizeof(header) && (bool)file.read((char*)&header, sizeof(header))
+                  && header.magic == MAGIC && header.version == VERSION && header.length > 0 && header.length <= fileSize - sizeof(header)
+                  && header.length <= (uint32_t)INT32_MAX;
+        if(valid){
+            binary.resize(header.length);
+            valid = (bool)file.read(binary.data(), header.length);
+        }
+        file.close();
+
+        GLint linked = GL_FALSE;
+        if(valid){
+            programBinary(program, header.format, binary.data(), (GLsizei)header.length);
+            glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        }
+        if(!linked){
+            std::filesystem::remove(path, error);
+            misses += 1;
+            return false;
+        }
+        // mark the entry used, for eviction
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+        hits += 1;
+        return true;
+    }
+
+    // write a freshly linked program's binary (see writeFileAtomically, so a
+    // crash never leaves a truncated entry behind)
+    // ------------------------------------------------------------------------
+    static void store(uint64_t programKey, GLuint program)
+    {
+        if(!enabled)
+            return;
+
+        GLint length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if(length <= 0)
+            return;
+
+        // header and binary in one buffer, the driver writing after the header
+        std::vector<char> bytes(sizeof(EntryHeader) + (size_t)length);
+        GLsizei written = 0;
+        GLenum format = 0;
+        getProgramBinary(program, length, &written, &format, &bytes[sizeof(EntryHeader)]);
+        if(written <= 0)
+            return;
+
+        EntryHeader header;
+        header.magic = MAGIC;
+        header.version = VERSION;
+        header.format = format;
+        header.length = (uint32_t)written;
+        std::memcpy(&bytes[0], &header, sizeof(header));
+        bytes.resize(sizeof(header) + (size_t)written);
+        writeFileAtomically(entryPath(programKey), bytes);
+        evict();
+    }
+
+    static unsigned int hitCount() { return hits; }
+    static unsigned int missCount() { return misses; }
+
+private:
+    struct EntryHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t format;
+        uint32_t length;
+    };
+    static const uint32_t MAGIC = 0x42505353; // "SSPB"
+    static const uint32_t VERSION = 1;
+    static const size_t MAX_ENTRIES = 64;
+
+    static inline bool enabled = false;
+    static inline std::string directory;
+    static inline std::string driverKey;
+    static inline unsigned int hits = 0;
+    static inline unsigned int misses = 0;
+
+    static inline PFNPROGRAMBINARYPROC programBinary = NULL;
+    static inline PFNGETPROGRAMBINARYPROC getProgramBinary = NULL;
+    static inline PFNPROGRAMPARAMETERIPROC programParameteri = NULL;
+
+    static std::string entryPath(uint64_t programKey)
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)programKey);
+        return (std::filesystem::path(directory) / name).string();
+    }
+
+    // drop the least recently used entries beyond MAX_ENTRIES
+    // ------------------------------------------------------------------------
+    static void evict()
+    {
+        std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path> > entries;
+        std::error_code error;
+        for(std::filesystem::directory_iterator it(directory, error), end; !error && it != end; it.increment(error)){
+            if(it->path().extension() != ".bin")
+                continue;
+            std::error_code timeError;
+            std::filesystem::file_time_type used = it->last_write_time(timeError);
+            if(!timeError)
+                entries.push_back(std::make_pair(used, it->path()));
+        }
+        if(entries.size() <= MAX_ENTRIES)
+            return;
+        std::sort(entries.begin(), entries.end());
+        for(size_t i = 0; i + MAX_ENTRIES < entries.size(); i++)
+            std::filesystem::remove(entries[i].second, error);
+    }
+};
+
+#endif
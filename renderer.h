@@ -0,0 +1,619 @@
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include "character.h"
+#include "fontcache.h"
+#ifndef SHAPE_SHIFT_NO_FREETYPE
+#include "fontbake.h"
+#endif
+#include "circlemesh.h"
+#include "gputimer.h"
+#include "renderqueue.h"
+#include "transforms.h"
+#include "shader.h"
+#include "world.h"
+#include "profiler.h"
+
+// the HUD font is baked once as a distance field at this pixel height,
+// reaching FONT_SDF_SPREAD atlas pixels past the glyph edges; the one atlas
+// draws text sharply at any size
+const int FONT_PIXEL_SIZE = 32;
+const int FONT_SDF_SPREAD = 4;
+
+// RenderText's scale 1 is text this many pixels high (the size the HUD
+// layout was made for), whatever FONT_PIXEL_SIZE is
+const float TEXT_BASE_SIZE = 48.0f;
+
+// uniform buffer binding point of the std140 Camera block (view, projection)
+// shared by every shader.vs-based program
+const GLuint CAMERA_BINDING = 0;
+
+// handles for the per-draw uniforms of the shader.vs-based programs
+// ------------------------------------------------------------------------
+struct SceneUniforms
+{
+    UniformHandle model;
+
+    void resolve(const Shader &program)
+    {
+        model = program.uniform("model");
+    }
+};
+
+// optional effects for RenderText, drawn in the same pass as the glyphs
+// from the distance field. widths and offsets are screen pixels at scale 1;
+// both are limited by the field's spread (about 6 px with the defaults)
+// ------------------------------------------------------------------------
+struct TextStyle
+{
+    glm::vec4 outlineColor = glm::vec4(0.0f);
+    float outlineWidth = 0.0f;
+    glm::vec4 shadowColor = glm::vec4(0.0f);
+    glm::vec2 shadowOffset = glm::vec2(0.0f);   // +y is up
+};
+
+// draws a World; owns every GL object but none of the game state, which it
+// only reads from the World handed to draw()
+// ------------------------------------------------------------------------
+class Renderer
+{
+public:
+    // VBO[5], VBO[6] hold the per-target x and y streams for VAO[3], VBO[7]
+    // the active bitmask read through targetActiveTexture, VBO[8] the ball
+    // matrices instanced over the circle mesh in VAO[2]
+    unsigned int VBO[9], VAO[5], EBO[1];
+    CircleMeshCache circles;
+    unsigned int targetActiveTexture;
+    unsigned int cameraUBO;
+
+    Shader shader;
+    Shader shader1;
+    Shader shader2;
+    Shader shaderTargets;
+    Shader shaderBalls;
+
+    SceneUniforms uniforms1;
+    SceneUniforms uniforms2;
+    UniformHandle textProjectionUniform;
+    UniformHandle textColorUniform;
+    UniformHandle textOutlineColorUniform;
+    UniformHandle textOutlineWidthUniform;
+    UniformHandle textShadowColorUniform;
+    UniformHandle textShadowOffsetUniform;
+
+    glm::mat4 view;
+    glm::mat4 projection;
+
+    // per-pass GPU times, shown next to the score
+    GpuTimerPool gpuTimers;
+
+    // requires a current GL context
+    // ------------------------------------------------------------------------
+    Renderer(unsigned int width, unsigned int height)
+        : shader("text.vs", "text.fs"),
+          shader1("shader.vs", "fragment1.fs"),
+          shader2("shader.vs", "fragment2.fs"),
+          shaderTargets("target.vs", "fragment1.fs"),
+          shaderBalls("ball.vs", "fragment2.fs")
+    {
+        screenWidth = width;
+        screenHeight = height;
+
+        gpuTimers.init();
+        paddlePass = gpuTimers.addPass("PADDLE");
+        ballPass = gpuTimers.addPass("BALL");
+        targetsPass = gpuTimers.addPass("TARGETS");
+        textPass = gpuTimers.addPass("TEXT");
+
+        uniforms1.resolve(shader1);
+        uniforms2.resolve(shader2);
+
+        shader1.bindUniformBlock("Camera", CAMERA_BINDING);
+        shader2.bindUniformBlock("Camera", CAMERA_BINDING);
+        shaderTargets.bindUniformBlock("Camera", CAMERA_BINDING);
+        shaderBalls.bindUniformBlock("Camera", CAMERA_BINDING);
+        textProjectionUniform = shader.uniform("projection");
+        textColorUniform = shader.uniform("textColor");
+        textOutlineColorUniform = shader.uniform("outlineColor");
+        textOutlineWidthUniform = shader.uniform("outlineWidth");
+        textShadowColorUniform = shader.uniform("shadowColor");
+        textShadowOffsetUniform = shader.uniform("shadowOffset");
+
+        // set up vertex data (and buffer(s)) and configure vertex attributes
+        // ------------------------------------------------------------------
+        float vertices[] = {
+             0.5f,  0.5f, 0.0f,  // top right 0
+             0.5f, -0.5f, 0.0f,  // bottom right 1
+            -0.5f, -0.5f, 0.0f,  // bottom left 2
+        };
+
+        float vertices2[] = {
+            -0.5f,  -0.5f, 0.0f,  // bottom left
+            -0.5f, 0.5f, 0.0f,
+            0.5f, 0.5f, 0.0f,
+        };
+
+        float targetVertices[] = {
+            0.5f,  0.5f, 0.0f,  // top right
+            0.5f, -0.5f, 0.0f,  // bottom right
+            -0.5f, -0.5f, 0.0f,  // bottom left
+            -0.5f,  0.5f, 0.0f   // top left
+        };
+
+        unsigned int indices[] = {  // note that we start from 0!
+            0, 1, 3,  // first Triangle
+            1, 2, 3,   // second Triangle
+        };
+
+        glGenVertexArrays(5, VAO);
+        glGenBuffers(9, VBO);
+        glGenBuffers(1, EBO);
+
+        // bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
+        glBindVertexArray(VAO[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO[0]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+
+        glBindVertexArray(VAO[1]);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO[1]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices2), vertices2, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+
+        // every circle mesh, whatever its size, lives in VBO[2]; balls draw
+        // it instanced with one matrix each from VBO[8] (locations 1-4)
+        circles.attach(VAO[2], VBO[2]);
+        glBindVertexArray(VAO[2]);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO[8]);
+        for(int column = 0; column < 4; column++){
+            glVertexAttribPointer(1 + column, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceTransform), (void*)(sizeof(glm::vec4) * column));
+            glEnableVertexAttribArray(1 + column);
+            glVertexAttribDivisor(1 + column, 1);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+
+        glBindVertexArray(VAO[3]);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO[3]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(targetVertices), targetVertices, GL_STATIC_DRAW);
+        // EBO for target squares
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO[0]);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        // TargetField's x[] and y[] uploaded as-is, advanced once per instance
+        glBindBuffer(GL_ARRAY_BUFFER, VBO[5]);
+        glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, sizeof(float), (void*)0);
+        glEnableVertexAttribArray(1);
+        glVertexAttribDivisor(1, 1);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO[6]);
+        glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(float), (void*)0);
+        glEnableVertexAttribArray(2);
+        glVertexAttribDivisor(2, 1);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        // ...and its active bitmask as a texture buffer of 32-bit words
+        glBindBuffer(GL_TEXTURE_BUFFER, VBO[7]);
+        glBufferData(GL_TEXTURE_BUFFER, sizeof(uint32_t), NULL, GL_DYNAMIC_DRAW);
+        glGenTextures(1, &targetActiveTexture);
+        glBindTexture(GL_TEXTURE_BUFFER, targetActiveTexture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_R32UI, VBO[7]);
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+        shaderTargets.use();
+        shaderTargets.setInt("activeBits", 1);
+
+        // Text
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        glm::mat4 textProjection = glm::ortho(0.0f, static_cast<float>(screenWidth), 0.0f, static_cast<float>(screenHeight));
+        shader.use();
+        shader.set(textProjectionUniform, textProjection);
+
+        glBindVertexArray(VAO[4]);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO[4]);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), 0 );
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+
+        // camera block: two mat4s, filled by updateCamera()
+        glGenBuffers(1, &cameraUBO);
+        glBindBuffer(GL_UNIFORM_BUFFER, cameraUBO);
+        glBufferData(GL_UNIFORM_BUFFER, 2 * sizeof(glm::mat4), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        glBindBufferBase(GL_UNIFORM_BUFFER, CAMERA_BINDING, cameraUBO);
+
+        view = glm::mat4(1.0f);
+        view = glm::translate(view, glm::vec3(0.0f, 0.0f, -3.0f));
+
+        resize(screenWidth, screenHeight);
+    }
+
+    // new framebuffer size; the camera block is re-uploaded on the next draw
+    // ------------------------------------------------------------------------
+    void resize(int width, int height)
+    {
+        if(width <= 0 || height <= 0)
+            return;
+        screenWidth = (unsigned int)width;
+        screenHeight = (unsigned int)height;
+        projection = glm::perspective(glm::radians(90.0f), (float)width / (float)height, 0.1f, 100.0f);
+        cameraDirty = true;
+    }
+
+    // screen pixels covered by one world unit at the z = 0 game plane
+    // ------------------------------------------------------------------------
+    float pixelsPerUnit() const
+    {
+        float distance = -view[3][2];
+        return projection[1][1] / distance * 0.5f * (float)screenHeight;
+    }
+
+    // load the HUD font's distance field from its baked cache file (mapped,
+    // no parsing, one texture upload). if the cache is missing or stale (say
+    // fontPath was replaced) it is baked from fontPath with FreeType first
+    // and written for the next launch; builds with SHAPE_SHIFT_NO_FREETYPE
+    // need the cache to exist (tools/bake_font)
+    // ------------------------------------------------------------------------
+    bool loadFont(const std::string &cachePath, const std::string &fontPath)
+    {
+        FontCacheFile cache;
+        if(cache.open(cachePath, FONT_PIXEL_SIZE, fontPath)){
+            const FontCacheHeader *header = cache.header();
+            cache.copyGlyphs(Characters);
+            setFontMetrics((int)header->pixelSize, header->lineHeight, (int)header->spread);
+            uploadGlyphAtlas(cache.pixels(), (int)header->atlasWidth, (int)header->atlasHeight);
+            return true;
+        }
+
+#ifndef SHAPE_SHIFT_NO_FREETYPE
+        FontAtlas atlas;
+        if(!bakeFontAtlas(fontPath, FONT_PIXEL_SIZE, FONT_SDF_SPREAD, atlas))
+            return false;
+        writeFontCache(cachePath, fontPath, atlas.pixelSize, atlas.lineHeight, atlas.spread, atlas.glyphs, atlas.pixels.data(), atlas.width, atlas.height);
+
+        for(int c = 0; c < CHARACTER_COUNT; c++)
+            Characters[c] = atlas.glyphs[c];
+        setFontMetrics(atlas.pixelSize, atlas.lineHeight, atlas.spread);
+        uploadGlyphAtlas(atlas.pixels.data(), atlas.width, atlas.height);
+        return true;
+#else
+        std::cout << "ERROR::FONT_CACHE: Missing or stale " << cachePath << " (bake it from " << fontPath << " with tools/bake_font)" << std::endl;
+        return false;
+#endif
+    }
+
+    // draw one frame of the given state; moving objects are placed at the
+    // interpolated positions in motion rather than the latest tick
+    // ------------------------------------------------------------------------
+    void draw(const World &world, const MotionState &motion)
+    {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        gpuTimers.beginFrame();
+
+        updateCamera();
+
+        glm::mat4 model = glm::mat4(1.0f);
+        model = glm::translate(model, glm::vec3(motion.paddleX, motion.paddleY, 0.0f));
+
+        {
+            PROFILE_ZONE("queue draws");
+            queue.clear();
+            textVertices.clear();
+
+            // paddle, one triangle per program
+            DrawCommand command;
+            command.layer = LAYER_WORLD;
+            command.pass = paddlePass;
+            command.zone = "draw paddle";
+            command.program = &shader1;
+            command.vertexArray = VAO[0];
+            command.count = 3;
+            queue.add(command);
+            queue.uniform(uniforms1.model, model);
+
+            command.program = &shader2;
+            command.vertexArray = VAO[1];
+            queue.add(command);
+            queue.uniform(uniforms2.model, model);
+
+            // every ball in one instanced draw, tessellated for its size on screen
+            const CircleMesh &ball = circles.get(World::CIRCLE_RADIUS, CircleMeshCache::segmentsForPixelRadius(World::CIRCLE_RADIUS * pixelsPerUnit()));
+            circles.upload();
+            uploadBalls(motion);
+            if(!motion.balls.empty()){
+                command.pass = ballPass;
+                command.zone = "draw ball";
+                command.program = &shaderBalls;
+                command.vertexArray = circles.vertexArray();
+                command.primitive = GL_TRIANGLE_FAN;
+                command.first = ball.first;
+                command.count = ball.count;
+                command.instances = (GLsizei)motion.balls.size();
+                queue.add(command);
+            }
+
+            // all targets in one instanced draw
+            uploadTargets(world);
+            if(world.targets.size() > 0){
+                DrawCommand targets;
+                targets.layer = LAYER_WORLD;
+                targets.pass = targetsPass;
+                targets.zone = "draw targets";
+                targets.program = &shaderTargets;
+                targets.vertexArray = VAO[3];
+                targets.textureTarget = GL_TEXTURE_BUFFER;
+                targets.textureUnit = 1;
+                targets.texture = targetActiveTexture;
+                targets.count = 6;
+                targets.indexType = GL_UNSIGNED_INT;
+                targets.instances = (GLsizei)world.targets.size();
+                queue.add(targets);
+            }
+
+            std::string score = std::to_string(world.score);
+
+            TextStyle scoreStyle;
+            scoreStyle.shadowColor = glm::vec4(0.0f, 0.0f, 0.0f, 0.6f);
+            scoreStyle.shadowOffset = glm::vec2(3.0f, -3.0f);
+            RenderText("SCORE - ", 580.0f, 25.0f, 0.6f, glm::vec3(1.0f, 1.0f, 1.0f), scoreStyle);
+            RenderText(score, 710.0f, 25.0f, 0.6f, glm::vec3(1.0f, 1.0f, 1.0f), scoreStyle);
+
+            // timings to the right of the score, last line on its baseline
+            gpuTimers.format(gpuTimerText);
+            float lines = (float)std::count(gpuTimerText.begin(), gpuTimerText.end(), '\n');
+            RenderText(gpuTimerText, 780.0f, 25.0f + lines * lineHeight * 0.3f, 0.3f, glm::vec3(0.6f, 0.6f, 0.6f));
+            uploadText();
+
+            queue.sort();
+        }
+
+        // one GPU timer and profiler zone per pass: paddle, ball, targets, text
+        queue.execute(LAYER_WORLD, &gpuTimers);
+        queue.execute(LAYER_HUD, &gpuTimers);
+        queue.finish();
+    }
+
+    // build the quads for a whole string and queue them as one HUD draw for
+    // the current frame; '\n' starts a new line below. scale 1 is
+    // TEXT_BASE_SIZE pixels high
+    // ------------------------------------------------------------------------
+    void RenderText(const std::string &text, float x, float y, float scale, glm::vec3 color, const TextStyle &style = TextStyle())
+    {
+        size_t firstFloat = textVertices.size();
+        float startX = x;
+        float textScale = scale;
+        scale *= fontScale;
+
+        for (std::string::const_iterator c = text.begin(); c != text.end(); c++)
+        {
+            unsigned char code = (unsigned char)*c;
+            if(code == '\n'){
+                x = startX;
+                y -= lineHeight * textScale;
+                continue;
+            }
+            if(code >= CHARACTER_COUNT)
+                continue;
+            const Character &ch = Characters[code];
+
+            float xpos = x + ch.Bearing.x * scale;
+            float ypos = y - (ch.Size.y - ch.Bearing.y) * scale;
+
+            float w = ch.Size.x * scale;
+            float h = ch.Size.y * scale;
+
+            float vertices[6][4] = {
+                { xpos,     ypos + h,   ch.UVMin.x, ch.UVMin.y },
+                { xpos,     ypos,       ch.UVMin.x, ch.UVMax.y },
+                { xpos + w, ypos,       ch.UVMax.x, ch.UVMax.y },
+
+                { xpos,     ypos + h,   ch.UVMin.x, ch.UVMin.y },
+                { xpos + w, ypos,       ch.UVMax.x, ch.UVMax.y },
+                { xpos + w, ypos + h,   ch.UVMax.x, ch.UVMin.y }
+            };
+            textVertices.insert(textVertices.end(), &vertices[0][0], &vertices[0][0] + 6 * 4);
+
+            // now advance cursors for next glyph (note that advance is number of 1/64 pixels);
+            // kept fractional, the atlas is small enough that rounding shows once scaled up
+            x += (ch.Advance / 64.0f) * scale;
+        }
+
+        if(textVertices.size() == firstFloat)
+            return;
+
+        DrawCommand command;
+        command.layer = LAYER_HUD;
+        command.pass = textPass;
+        command.zone = "draw text";
+        command.program = &shader;
+        command.vertexArray = VAO[4];
+        command.texture = glyphAtlas;
+        command.first = (GLint)(firstFloat / 4);
+        command.count = (GLsizei)((textVertices.size() - firstFloat) / 4);
+        queue.add(command);
+
+        // effects are specified in screen pixels at scale 1; the shader
+        // wants field units and texture coordinates
+        queue.uniform(textColorUniform, color);
+        queue.uniform(textOutlineColorUniform, style.outlineColor);
+        queue.uniform(textOutlineWidthUniform, style.outlineWidth / fontScale / (2.0f * fontSpread));
+        queue.uniform(textShadowColorUniform, style.shadowColor);
+        queue.uniform(textShadowOffsetUniform, glm::vec2(style.shadowOffset.x, -style.shadowOffset.y) / fontScale / glyphAtlasSize);
+    }
+
+    const RenderQueueStats& queueStats() const { return queue.stats(); }
+
+private:
+    unsigned int screenWidth;
+    unsigned int screenHeight;
+
+    bool cameraDirty = true;
+
+    unsigned int glyphAtlas = 0;
+    glm::vec2 glyphAtlasSize = glm::vec2(1.0f);
+    // TEXT_BASE_SIZE over the pixel size the atlas was baked at
+    float fontScale = 1.0f;
+    float fontSpread = (float)FONT_SDF_SPREAD;
+    // baseline to baseline distance at scale 1, from the font once loaded
+    float lineHeight = 58.0f;
+    std::vector<float> textVertices;
+    size_t textVertexCapacity = 6 * 4;
+
+    unsigned int uploadedLayoutVersion = 0;
+    unsigned int uploadedActiveVersion = 0;
+    size_t uploadedActiveWords = 0;
+    bool targetInstancesValid = false;
+
+    int paddlePass;
+    int ballPass;
+    int targetsPass;
+    int textPass;
+
+    // this frame's draws, rebuilt by draw() and run sorted by state
+    RenderQueue queue;
+
+    TransformArray ballTransforms;
+    size_t ballInstanceCapacity = 0;
+    std::string gpuTimerText;
+
+    void setFontMetrics(int pixelSize, int atlasLineHeight, int spread)
+    {
+        fontScale = TEXT_BASE_SIZE / (float)pixelSize;
+        fontSpread = (float)spread;
+        lineHeight = atlasLineHeight * fontScale;
+    }
+
+    // the single-channel distance field RenderText samples from; linear
+    // filtering interpolates distances, which is what keeps edges sharp
+    // ------------------------------------------------------------------------
+    void uploadGlyphAtlas(const unsigned char *pixels, int atlasWidth, int atlasHeight)
+    {
+        // disable byte-alignment restriction
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        if(glyphAtlas == 0)
+            glGenTextures(1, &glyphAtlas);
+        glyphAtlasSize = glm::vec2((float)atlasWidth, (float)atlasHeight);
+        glBindTexture(GL_TEXTURE_2D, glyphAtlas);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, atlasWidth, atlasHeight, 0, GL_RED, GL_UNSIGNED_BYTE, pixels);
+        // set texture options
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    // upload view/projection to the camera block only when they changed
+    // ------------------------------------------------------------------------
+    void updateCamera()
+    {
+        if(!cameraDirty)
+            return;
+        glBindBuffer(GL_UNIFORM_BUFFER, cameraUBO);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(glm::mat4), glm::value_ptr(view));
+        glBufferSubData(GL_UNIFORM_BUFFER, sizeof(glm::mat4), sizeof(glm::mat4), glm::value_ptr(projection));
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        cameraDirty = false;
+    }
+
+    // ball matrices into VBO[8]: only the ones whose position changed are
+    // rebuilt, and only the range they span is sent
+    // ------------------------------------------------------------------------
+    void uploadBalls(const MotionState &motion)
+    {
+        ballTransforms.resize(motion.balls.size());
+        for(size_t i = 0; i < motion.balls.size(); i++)
+            ballTransforms.set(i, motion.balls[i].x, motion.balls[i].y);
+        ballTransforms.update();
+
+        size_t begin = ballTransforms.uploadRangeBegin();
+        size_t end = ballTransforms.uploadRangeEnd();
+        if(begin == end)
+            return;
+        glBindBuffer(GL_ARRAY_BUFFER, VBO[8]);
+        if(ballTransforms.size() > ballInstanceCapacity){
+            // grow with headroom so a multiball burst does not reallocate every frame
+            ballInstanceCapacity = std::max(ballTransforms.size(), ballInstanceCapacity * 2);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(InstanceTransform) * ballInstanceCapacity, NULL, GL_DYNAMIC_DRAW);
+            begin = 0;
+            end = ballTransforms.size();
+        }
+        glBufferSubData(GL_ARRAY_BUFFER, sizeof(InstanceTransform) * begin, sizeof(InstanceTransform) * (end - begin), ballTransforms.data() + begin);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        ballTransforms.markUploaded();
+    }
+
+    // every string queued this frame in one upload, growing the buffer only
+    // when the frame has more text than ever before
+    // ------------------------------------------------------------------------
+    void uploadText()
+    {
+        if(textVertices.empty())
+            return;
+        glBindBuffer(GL_ARRAY_BUFFER, VBO[4]);
+        if(textVertices.size() > textVertexCapacity){
+            glBufferData(GL_ARRAY_BUFFER, sizeof(float) * textVertices.size(), textVertices.data(), GL_DYNAMIC_DRAW);
+            textVertexCapacity = textVertices.size();
+        }
+        else{
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(float) * textVertices.size(), textVertices.data());
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    // copy TargetField straight into the instance buffers, each part only when
+    // it changed: positions on a new layout, the bitmask when a target dies
+    // ------------------------------------------------------------------------
+    void uploadTargets(const World &world)
+    {
+        const TargetField &targets = world.targets;
+        bool layoutChanged = !targetInstancesValid || uploadedLayoutVersion != targets.layoutVersion;
+        bool activeChanged = layoutChanged || uploadedActiveVersion != targets.activeVersion;
+
+        if(layoutChanged){
+            glBindBuffer(GL_ARRAY_BUFFER, VBO[5]);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(float) * targets.x.size(), targets.x.data(), GL_STATIC_DRAW);
+            glBindBuffer(GL_ARRAY_BUFFER, VBO[6]);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(float) * targets.y.size(), targets.y.data(), GL_STATIC_DRAW);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+
+        if(activeChanged && !targets.active.empty()){
+            glBindBuffer(GL_TEXTURE_BUFFER, VBO[7]);
+            if(targets.active.size() != uploadedActiveWords){
+                glBufferData(GL_TEXTURE_BUFFER, sizeof(uint32_t) * targets.active.size(), targets.active.data(), GL_DYNAMIC_DRAW);
+                uploadedActiveWords = targets.active.size();
+            }
+            else{
+                glBufferSubData(GL_TEXTURE_BUFFER, 0, sizeof(uint32_t) * targets.active.size(), targets.active.data());
+            }
+            glBindBuffer(GL_TEXTURE_BUFFER, 0);
+        }
+
+        uploadedLayoutVersion = targets.layoutVersion;
+        uploadedActiveVersion = targets.activeVersion;
+        targetInstancesValid = true;
+    }
+};
+
+#endif
@@ -0,0 +1,281 @@
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include "shader.h"
+#include "gputimer.h"
+#include "profiler.h"
+
+// layers run back to front in this order; within a layer commands are free
+// to be reordered, so anything that must draw on top goes in a later layer
+enum RenderLayer
+{
+    LAYER_WORLD = 0,
+    LAYER_HUD = 1,
+    LAYER_COUNT
+};
+
+// one uniform value carried by a draw command, applied through the
+// command's Shader so its redundant-value filter still sees it
+// ------------------------------------------------------------------------
+struct UniformValue
+{
+    UniformHandle handle;
+    GLenum type;        // GL_FLOAT, GL_FLOAT_VEC2/3/4 or GL_FLOAT_MAT4
+    float data[16];
+};
+
+// everything one draw needs. texture is optional (0 binds nothing);
+// indexType 0 draws arrays from first, otherwise elements from the VAO's
+// element buffer starting at index first. instances 0 is a plain draw (so
+// an instanced draw of nothing should not be queued at all). pass groups
+// commands into one GPU timer pass (a GpuTimerPool id, -1 for none) and
+// one profiler zone (zone, a string literal)
+// ------------------------------------------------------------------------
+struct DrawCommand
+{
+    int layer = LAYER_WORLD;
+    int pass = -1;
+    const char *zone = "draw";
+    Shader *program = NULL;
+    unsigned int vertexArray = 0;
+    GLenum textureTarget = GL_TEXTURE_2D;
+    unsigned int textureUnit = 0;
+    unsigned int texture = 0;
+    GLenum primitive = GL_TRIANGLES;
+    GLint first = 0;
+    GLsizei count = 0;
+    GLenum indexType = 0;
+    GLsizei instances = 0;
+
+    // into the queue's uniform payload
+    uint32_t uniformOffset = 0;
+    uint32_t uniformCount = 0;
+};
+
+// state changes of the last frame the queue executed
+struct RenderQueueStats
+{
+    unsigned int commands;
+    unsigned int draws;
+    unsigned int programChanges;
+    unsigned int vertexArrayChanges;
+    unsigned int textureChanges;
+    unsigned int uniformValues;
+};
+
+// draw commands collected for a frame, sorted by a 64-bit state key and
+// executed with every program, VAO and texture bind that would repeat the
+// current one skipped. the command and payload arrays are kept between
+// frames, so a steady scene queues without allocating
+//
+// key, high to low: layer (8 bits) | pass (8) | program (16) | texture (16)
+// | VAO (16). a pass's commands therefore run back to back and can be timed
+// as one; state is sorted within each pass. GL object names are small
+// integers in practice; if two ever alias after masking, the sort only
+// loses a little grouping, the binds are still checked against the real
+// names
+// ------------------------------------------------------------------------
+class RenderQueue
+{
+public:
+    static const unsigned int MAX_TEXTURE_UNITS = 4;
+    static const unsigned int UNKNOWN_UNIT = ~0u;
+
+    // start a new frame; the previous frame's stats stay readable until the
+    // next sort()
+    void clear()
+    {
+        commands.clear();
+        payload.clear();
+    }
+
+    // queue a draw; uniforms added right after go with it
+    DrawCommand& add(const DrawCommand &command)
+    {
+        commands.push_back(command);
+        DrawCommand &added = commands.back();
+        added.uniformOffset = (uint32_t)payload.size();
+        added.uniformCount = 0;
+        return added;
+    }
+
+    void uniform(UniformHandle handle, float value) { push(handle, GL_FLOAT, &value, 1); }
+    void uniform(UniformHandle handle, const glm::vec2 &value) { push(handle, GL_FLOAT_VEC2, &value[0], 2); }
+    void uniform(UniformHandle handle, const glm::vec3 &value) { push(handle, GL_FLOAT_VEC3, &value[0], 3); }
+    void uniform(UniformHandle handle, const glm::vec4 &value) { push(handle, GL_FLOAT_VEC4, &value[0], 4); }
+    void uniform(UniformHandle handle, const glm::mat4 &value) { push(handle, GL_FLOAT_MAT4, &value[0][0], 16); }
+
+    // order the frame's commands; ties keep submission order
+    // ------------------------------------------------------------------------
+    void sort()
+    {
+        order.resize(commands.size());
+        for(size_t i = 0; i < commands.size(); i++)
+            order[i] = std::make_pair(key(commands[i]), (uint32_t)i);
+        std::sort(order.begin(), order.end());
+
+        std::memset(&frameStats, 0, sizeof(frameStats));
+        frameStats.commands = (unsigned int)commands.size();
+        frameStats.uniformValues = (unsigned int)payload.size();
+
+        // nothing is known about GL state at the start of a frame
+        currentProgram = 0;
+        currentVertexArray = 0;
+        activeUnit = UNKNOWN_UNIT;
+        std::memset(currentTextures, 0, sizeof(currentTextures));
+        stateKnown = false;
+    }
+
+    // run the sorted commands of one layer; requires sort(). each pass's
+    // commands are bracketed with its GPU timer (if timers are given) and
+    // its profiler zone
+    // ------------------------------------------------------------------------
+    void execute(int layer, GpuTimerPool *timers = NULL)
+    {
+        size_t i = 0;
+        while(i < order.size()){
+            const DrawCommand &first = commands[order[i].second];
+            if(first.layer != layer){
+                i++;
+                continue;
+            }
+
+            int pass = first.pass;
+            PROFILE_ZONE(first.zone);
+            if(timers != NULL)
+                timers->begin(pass);
+            for(; i < order.size(); i++){
+                const DrawCommand &command = commands[order[i].second];
+                if(command.layer != layer || command.pass != pass)
+                    break;
+                submit(command);
+            }
+            if(timers != NULL)
+                timers->end(pass);
+        }
+    }
+
+    // leave the default texture unit active and nothing bound, like the
+    // hand-written passes used to
+    void finish()
+    {
+        if(activeUnit != 0 && activeUnit != UNKNOWN_UNIT)
+            glActiveTexture(GL_TEXTURE0);
+        activeUnit = 0;
+        glBindVertexArray(0);
+        currentVertexArray = 0;
+    }
+
+    const RenderQueueStats& stats() const { return frameStats; }
+    size_t size() const { return commands.size(); }
+
+private:
+    std::vector<DrawCommand> commands;
+    std::vector<UniformValue> payload;
+    std::vector<std::pair<uint64_t, uint32_t> > order;
+
+    RenderQueueStats frameStats = RenderQueueStats();
+
+    bool stateKnown = false;
+    unsigned int currentProgram = 0;
+    unsigned int currentVertexArray = 0;
+    unsigned int activeUnit = 0;
+    unsigned int currentTextures[MAX_TEXTURE_UNITS] = {};
+
+    // bind what command needs that is not bound yet, then draw it
+    // ------------------------------------------------------------------------
+    void submit(const DrawCommand &command)
+    {
+        if(!stateKnown || command.program->ID != currentProgram){
+            command.program->use();
+            currentProgram = command.program->ID;
+            frameStats.programChanges += 1;
+        }
+        if(!stateKnown || command.vertexArray != currentVertexArray){
+            glBindVertexArray(command.vertexArray);
+            currentVertexArray = command.vertexArray;
+            frameStats.vertexArrayChanges += 1;
+        }
+        stateKnown = true;
+
+        if(command.texture != 0 && currentTextures[command.textureUnit] != command.texture){
+            if(activeUnit != command.textureUnit){
+                glActiveTexture(GL_TEXTURE0 + command.textureUnit);
+                activeUnit = command.textureUnit;
+            }
+            glBindTexture(command.textureTarget, command.texture);
+            currentTextures[command.textureUnit] = command.texture;
+            frameStats.textureChanges += 1;
+        }
+
+        for(uint32_t u = 0; u < command.uniformCount; u++)
+            apply(*command.program, payload[command.uniformOffset + u]);
+
+        draw(command);
+        frameStats.draws += 1;
+    }
+
+    static uint64_t key(const DrawCommand &command)
+    {
+        return ((uint64_t)(command.layer & 0xFF) << 56)
+             | ((uint64_t)((command.pass + 1) & 0xFF) << 48)
+             | ((uint64_t)(command.program->ID & 0xFFFF) << 32)
+             | ((uint64_t)(command.texture & 0xFFFF) << 16)
+             | (uint64_t)(command.vertexArray & 0xFFFF);
+    }
+
+    void push(UniformHandle handle, GLenum type, const float *data, int count)
+    {
+        if(commands.empty())
+            return;
+        UniformValue value;
+        value.handle = handle;
+        value.type = type;
+        std::memcpy(value.data, data, sizeof(float) * count);
+        payload.push_back(value);
+        commands.back().uniformCount += 1;
+    }
+
+    static void apply(const Shader &program, const UniformValue &value)
+    {
+        switch(value.type){
+            case GL_FLOAT: program.set(value.handle, value.data[0]); break;
+            case GL_FLOAT_VEC2: program.set(value.handle, glm::vec2(value.data[0], value.data[1])); break;
+            case GL_FLOAT_VEC3: program.set(value.handle, glm::vec3(value.data[0], value.data[1], value.data[2])); break;
+            case GL_FLOAT_VEC4: program.set(value.handle, glm::vec4(value.data[0], value.data[1], value.data[2], value.data[3])); break;
+            case GL_FLOAT_MAT4:{
+                glm::mat4 mat;
+                std::memcpy(&mat[0][0], value.data, sizeof(mat));
+                program.set(value.handle, mat);
+                break;
+            }
+        }
+    }
+
+    static void draw(const DrawCommand &command)
+    {
+        if(command.indexType == 0){
+            if(command.instances > 0)
+                glDrawArraysInstanced(command.primitive, command.first, command.count, command.instances);
+            else
+                glDrawArrays(command.primitive, command.first, command.count);
+            return;
+        }
+
+        size_t indexSize = command.indexType == GL_UNSIGNED_INT ? 4 : (command.indexType == GL_UNSIGNED_SHORT ? 2 : 1);
+        const void *offset = (const void*)(command.first * indexSize);
+        if(command.instances > 0)
+            glDrawElementsInstanced(command.primitive, command.count, command.indexType, offset, command.instances);
+        else
+            glDrawElements(command.primitive, command.count, command.indexType, offset);
+    }
+};
+
+#endif
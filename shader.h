@@ -4,18 +4,53 @@
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 
+#include "programcache.h"
+
 #include <string>
+#include <vector>
+#include <utility>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <iostream>
 
+// pre-resolved reference to an active uniform of one Shader; look it up once
+// with Shader::uniform() and pass it to Shader::set() every frame
+// ------------------------------------------------------------------------
+struct UniformHandle
+{
+    int slot = -1;
+
+    bool valid() const { return slot >= 0; }
+};
+
 class Shader
 {
 public:
     unsigned int ID;
+
+    // one entry per active uniform, filled from the driver once after linking
+    struct UniformInfo
+    {
+        std::string name;
+        GLint location;
+        GLenum type;
+        GLint size;
+        unsigned int cacheOffset;
+        unsigned int cacheBytes;
+        mutable bool hasValue;
+    };
+    std::vector<UniformInfo> uniforms;
+
+    // where the sources came from, for reloading (geometryFile empty if none)
+    std::string vertexFile;
+    std::string fragmentFile;
+    std::string geometryFile;
+
     // constructor generates the shader on the fly
     // ------------------------------------------------------------------------
     Shader(const char* vertexPath, const char* fragmentPath, const char* geometryPath = nullptr)
+        : vertexFile(vertexPath), fragmentFile(fragmentPath), geometryFile(geometryPath != nullptr ? geometryPath : "")
     {
         // 1. retrieve the vertex/fragment source code from filePath
         std::string vertexCode;
@@ -57,44 +92,10 @@ public:
         {
             std::cout << "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ: " << e.what() << std::endl;
         }
-        const char* vShaderCode = vertexCode.c_str();
-        const char * fShaderCode = fragmentCode.c_str();
-        // 2. compile shaders
-        unsigned int vertex, fragment;
-        // vertex shader
-        vertex = glCreateShader(GL_VERTEX_SHADER);
-        glShaderSource(vertex, 1, &vShaderCode, NULL);
-        glCompileShader(vertex);
-        checkCompileErrors(vertex, "VERTEX");
-        // fragment Shader
-        fragment = glCreateShader(GL_FRAGMENT_SHADER);
-        glShaderSource(fragment, 1, &fShaderCode, NULL);
-        glCompileShader(fragment);
-        checkCompileErrors(fragment, "FRAGMENT");
-        // if geometry shader is given, compile geometry shader
-        unsigned int geometry;
-        if(geometryPath != nullptr)
-        {
-            const char * gShaderCode = geometryCode.c_str();
-            geometry = glCreateShader(GL_GEOMETRY_SHADER);
-            glShaderSource(geometry, 1, &gShaderCode, NULL);
-            glCompileShader(geometry);
-            checkCompileErrors(geometry, "GEOMETRY");
-        }
-        // shader Program
-        ID = glCreateProgram();
-        glAttachShader(ID, vertex);
-        glAttachShader(ID, fragment);
-        if(geometryPath != nullptr)
-            glAttachShader(ID, geometry);
-        glLinkProgram(ID);
-        checkCompileErrors(ID, "PROGRAM");
-        // delete the shaders as they're linked into our program now and no longer necessary
-        glDeleteShader(vertex);
-        glDeleteShader(fragment);
-        if(geometryPath != nullptr)
-            glDeleteShader(geometry);
+        // 2. link from the program binary cache, or compile from source
+        ID = buildProgram(vertexCode, fragmentCode, geometryCode, geometryPath != nullptr);
 
+        reflectUniforms();
     }
     // activate the shader
     // ------------------------------------------------------------------------
@@ -102,66 +103,346 @@ public:
     { 
         glUseProgram(ID); 
     }
-    // utility uniform functions
+    // attach a uniform block (e.g. the shared Camera block) to a buffer binding
+    // point; does nothing if the program does not use the block
+    // ------------------------------------------------------------------------
+    void bindUniformBlock(const char *blockName, GLuint binding)
+    {
+        GLuint index = glGetUniformBlockIndex(ID, blockName);
+        if(index != GL_INVALID_INDEX)
+            glUniformBlockBinding(ID, index, binding);
+        // remembered so a reloaded program gets the same bindings
+        for(size_t i = 0; i < blockBindings.size(); i++){
+            if(blockBindings[i].first == blockName){
+                blockBindings[i].second = binding;
+                return;
+            }
+        }
+        blockBindings.push_back(std::make_pair(std::string(blockName), binding));
+    }
+    // replace the program with one built from new sources. on a compile or
+    // link error the current program stays in place and false is returned.
+    // existing UniformHandles stay valid, and every uniform value and block
+    // binding set so far is applied to the new program
+    // ------------------------------------------------------------------------
+    bool reload(const std::string &vertexCode, const std::string &fragmentCode, const std::string &geometryCode)
+    {
+        GLuint program = buildProgram(vertexCode, fragmentCode, geometryCode, !geometryFile.empty());
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if(!linked){
+            glDeleteProgram(program);
+            return false;
+        }
+
+        glDeleteProgram(ID);
+        ID = program;
+
+        reflectUniforms();
+        std::vector<std::pair<std::string, GLuint> > bindings;
+        bindings.swap(blockBindings);
+        for(size_t i = 0; i < bindings.size(); i++)
+            bindUniformBlock(bindings[i].first.c_str(), bindings[i].second);
+        restoreUniforms();
+        return true;
+    }
+    // find a uniform by name; returns an invalid handle if the uniform is not
+    // active in this program (set() then does nothing)
+    // ------------------------------------------------------------------------
+    UniformHandle uniform(const std::string &name) const
+    {
+        UniformHandle handle;
+        for(size_t i = 0; i < uniforms.size(); i++){
+            if(uniforms[i].name == name){
+                handle.slot = (int)i;
+                break;
+            }
+        }
+        return handle;
+    }
+    // typed setters; the program must be in use. a value identical to the
+    // last one uploaded through this Shader is skipped
+    // ------------------------------------------------------------------------
+    void set(UniformHandle handle, bool value) const
+    {
+        set(handle, (int)value);
+    }
+    void set(UniformHandle handle, int value) const
+    {
+        if(changed(handle, &value, sizeof(value)))
+            glUniform1i(uniforms[handle.slot].location, value);
+    }
+    void set(UniformHandle handle, float value) const
+    {
+        if(changed(handle, &value, sizeof(value)))
+            glUniform1f(uniforms[handle.slot].location, value);
+    }
+    void set(UniformHandle handle, const glm::vec2 &value) const
+    {
+        if(changed(handle, &value[0], sizeof(value)))
+            glUniform2fv(uniforms[handle.slot].location, 1, &value[0]);
+    }
+    void set(UniformHandle handle, const glm::vec3 &value) const
+    {
+        if(changed(handle, &value[0], sizeof(value)))
+            glUniform3fv(uniforms[handle.slot].location, 1, &value[0]);
+    }
+    void set(UniformHandle handle, const glm::vec4 &value) const
+    {
+        if(changed(handle, &value[0], sizeof(value)))
+            glUniform4fv(uniforms[handle.slot].location, 1, &value[0]);
+    }
+    void set(UniformHandle handle, const glm::mat2 &mat) const
+    {
+        if(changed(handle, &mat[0][0], sizeof(mat)))
+            glUniformMatrix2fv(uniforms[handle.slot].location, 1, GL_FALSE, &mat[0][0]);
+    }
+    void set(UniformHandle handle, const glm::mat3 &mat) const
+    {
+        if(changed(handle, &mat[0][0], sizeof(mat)))
+            glUniformMatrix3fv(uniforms[handle.slot].location, 1, GL_FALSE, &mat[0][0]);
+    }
+    void set(UniformHandle handle, const glm::mat4 &mat) const
+    {
+        if(changed(handle, &mat[0][0], sizeof(mat)))
+            glUniformMatrix4fv(uniforms[handle.slot].location, 1, GL_FALSE, &mat[0][0]);
+    }
+    // utility uniform functions by name; these go through the reflected table
+    // rather than the driver, but prefer a cached UniformHandle in hot paths
     // ------------------------------------------------------------------------
     void setBool(const std::string &name, bool value) const
     {         
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value); 
+        set(uniform(name), value);
     }
     // ------------------------------------------------------------------------
     void setInt(const std::string &name, int value) const
     { 
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), value); 
+        set(uniform(name), value);
     }
     // ------------------------------------------------------------------------
     void setFloat(const std::string &name, float value) const
     { 
-        glUniform1f(glGetUniformLocation(ID, name.c_str()), value); 
+        set(uniform(name), value);
     }
     // ------------------------------------------------------------------------
     void setVec2(const std::string &name, const glm::vec2 &value) const
     { 
-        glUniform2fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]); 
+        set(uniform(name), value);
     }
     void setVec2(const std::string &name, float x, float y) const
     { 
-        glUniform2f(glGetUniformLocation(ID, name.c_str()), x, y); 
+        set(uniform(name), glm::vec2(x, y));
     }
     // ------------------------------------------------------------------------
     void setVec3(const std::string &name, const glm::vec3 &value) const
     { 
-        glUniform3fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]); 
+        set(uniform(name), value);
     }
     void setVec3(const std::string &name, float x, float y, float z) const
     { 
-        glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z); 
+        set(uniform(name), glm::vec3(x, y, z));
     }
     // ------------------------------------------------------------------------
     void setVec4(const std::string &name, const glm::vec4 &value) const
     { 
-        glUniform4fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]); 
+        set(uniform(name), value);
     }
     void setVec4(const std::string &name, float x, float y, float z, float w) 
     { 
-        glUniform4f(glGetUniformLocation(ID, name.c_str()), x, y, z, w); 
+        set(uniform(name), glm::vec4(x, y, z, w));
     }
     // ------------------------------------------------------------------------
     void setMat2(const std::string &name, const glm::mat2 &mat) const
     {
-        glUniformMatrix2fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        set(uniform(name), mat);
     }
     // ------------------------------------------------------------------------
     void setMat3(const std::string &name, const glm::mat3 &mat) const
     {
-        glUniformMatrix3fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        set(uniform(name), mat);
     }
     // ------------------------------------------------------------------------
     void setMat4(const std::string &name, const glm::mat4 &mat) const
     {
-        glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        set(uniform(name), mat);
     }
 
 private:
+    // last value uploaded for every uniform, addressed by UniformInfo::cacheOffset
+    mutable std::vector<unsigned char> uniformCache;
+    // (block name, binding point) for every bindUniformBlock call
+    std::vector<std::pair<std::string, GLuint> > blockBindings;
+
+    // a linked program for these sources: straight from the binary cache when
+    // the driver accepts the cached blob, otherwise compiled and linked (and
+    // then stored for next time)
+    // ------------------------------------------------------------------------
+    GLuint buildProgram(const std::string &vertexCode, const std::string &fragmentCode, const std::string &geometryCode, bool hasGeometry)
+    {
+        uint64_t cacheKey = 0;
+        if(ProgramBinaryCache::isEnabled()){
+            cacheKey = ProgramBinaryCache::key(vertexCode, fragmentCode, geometryCode);
+            GLuint cached = glCreateProgram();
+            if(ProgramBinaryCache::load(cacheKey, cached))
+                return cached;
+            glDeleteProgram(cached);
+        }
+
+        const char* vShaderCode = vertexCode.c_str();
+        const char * fShaderCode = fragmentCode.c_str();
+        // vertex shader
+        unsigned int vertex, fragment;
+        vertex = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertex, 1, &vShaderCode, NULL);
+        glCompileShader(vertex);
+        checkCompileErrors(vertex, "VERTEX");
+        // fragment Shader
+        fragment = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragment, 1, &fShaderCode, NULL);
+        glCompileShader(fragment);
+        checkCompileErrors(fragment, "FRAGMENT");
+        // if geometry shader is given, compile geometry shader
+        unsigned int geometry = 0;
+        if(hasGeometry)
+        {
+            const char * gShaderCode = geometryCode.c_str();
+            geometry = glCreateShader(GL_GEOMETRY_SHADER);
+            glShaderSource(geometry, 1, &gShaderCode, NULL);
+            glCompileShader(geometry);
+            checkCompileErrors(geometry, "GEOMETRY");
+        }
+        // shader Program
+        GLuint program = glCreateProgram();
+        ProgramBinaryCache::prepare(program);
+        glAttachShader(program, vertex);
+        glAttachShader(program, fragment);
+        if(hasGeometry)
+            glAttachShader(program, geometry);
+        glLinkProgram(program);
+        checkCompileErrors(program, "PROGRAM");
+        // delete the shaders as they're linked into our program now and no longer necessary
+        glDeleteShader(vertex);
+        glDeleteShader(fragment);
+        if(hasGeometry)
+            glDeleteShader(geometry);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if(linked && ProgramBinaryCache::isEnabled())
+            ProgramBinaryCache::store(cacheKey, program);
+        return program;
+    }
+    // query every active uniform once so no setter ever calls glGetUniformLocation.
+    // on a reload, uniforms keep their slot (and cached value) by name; ones
+    // the new program dropped get location -1, which GL silently ignores
+    // ------------------------------------------------------------------------
+    void reflectUniforms()
+    {
+        for(size_t i = 0; i < uniforms.size(); i++)
+            uniforms[i].location = -1;
+
+        GLint count = 0;
+        GLint maxLength = 0;
+        glGetProgramiv(ID, GL_ACTIVE_UNIFORMS, &count);
+        glGetProgramiv(ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+        std::vector<GLchar> nameBuffer(maxLength > 0 ? maxLength : 1);
+        for(GLint i = 0; i < count; i++)
+        {
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(ID, (GLuint)i, (GLsizei)nameBuffer.size(), &length, &size, &type, nameBuffer.data());
+
+            UniformInfo info;
+            info.name.assign(nameBuffer.data(), length);
+            info.location = glGetUniformLocation(ID, info.name.c_str());
+            // members of uniform blocks have no location and are set through buffers
+            if(info.location < 0)
+                continue;
+            // arrays are reported as "name[0]"; store them under the plain name
+            size_t bracket = info.name.find('[');
+            if(bracket != std::string::npos)
+                info.name.resize(bracket);
+            info.type = type;
+            info.size = size;
+            info.cacheBytes = uniformTypeBytes(type) * (unsigned int)size;
+            info.hasValue = false;
+
+            UniformHandle existing = uniform(info.name);
+            if(existing.valid()){
+                UniformInfo &slot = uniforms[existing.slot];
+                slot.location = info.location;
+                if(slot.type == info.type && slot.cacheBytes >= info.cacheBytes)
+                    continue;
+                // changed type or grew: the old cached value no longer applies
+                info.cacheOffset = (unsigned int)uniformCache.size();
+                uniformCache.resize(uniformCache.size() + info.cacheBytes);
+                slot = info;
+                continue;
+            }
+            info.cacheOffset = (unsigned int)uniformCache.size();
+            uniformCache.resize(uniformCache.size() + info.cacheBytes);
+            uniforms.push_back(info);
+        }
+    }
+    // upload every cached uniform value to the (new) program
+    // ------------------------------------------------------------------------
+    void restoreUniforms() const
+    {
+        glUseProgram(ID);
+        for(size_t i = 0; i < uniforms.size(); i++)
+        {
+            const UniformInfo &info = uniforms[i];
+            if(!info.hasValue || info.location < 0)
+                continue;
+            const unsigned char *value = uniformCache.data() + info.cacheOffset;
+            switch(info.type)
+            {
+                case GL_FLOAT: glUniform1fv(info.location, 1, (const GLfloat*)value); break;
+                case GL_FLOAT_VEC2: glUniform2fv(info.location, 1, (const GLfloat*)value); break;
+                case GL_FLOAT_VEC3: glUniform3fv(info.location, 1, (const GLfloat*)value); break;
+                case GL_FLOAT_VEC4: glUniform4fv(info.location, 1, (const GLfloat*)value); break;
+                case GL_INT_VEC2: case GL_BOOL_VEC2: glUniform2iv(info.location, 1, (const GLint*)value); break;
+                case GL_INT_VEC3: case GL_BOOL_VEC3: glUniform3iv(info.location, 1, (const GLint*)value); break;
+                case GL_INT_VEC4: case GL_BOOL_VEC4: glUniform4iv(info.location, 1, (const GLint*)value); break;
+                case GL_FLOAT_MAT2: glUniformMatrix2fv(info.location, 1, GL_FALSE, (const GLfloat*)value); break;
+                case GL_FLOAT_MAT3: glUniformMatrix3fv(info.location, 1, GL_FALSE, (const GLfloat*)value); break;
+                case GL_FLOAT_MAT4: glUniformMatrix4fv(info.location, 1, GL_FALSE, (const GLfloat*)value); break;
+                case GL_UNSIGNED_INT: glUniform1uiv(info.location, 1, (const GLuint*)value); break;
+                default: glUniform1iv(info.location, 1, (const GLint*)value); break; // ints, bools, samplers
+            }
+        }
+    }
+    // true (and remembered) if value differs from the last upload for handle
+    // ------------------------------------------------------------------------
+    bool changed(UniformHandle handle, const void *value, unsigned int bytes) const
+    {
+        if(!handle.valid())
+            return false;
+        const UniformInfo &info = uniforms[handle.slot];
+        if(bytes > info.cacheBytes)
+            bytes = info.cacheBytes;
+        unsigned char *cached = uniformCache.data() + info.cacheOffset;
+        if(info.hasValue && memcmp(cached, value, bytes) == 0)
+            return false;
+        memcpy(cached, value, bytes);
+        info.hasValue = true;
+        return true;
+    }
+    // ------------------------------------------------------------------------
+    static unsigned int uniformTypeBytes(GLenum type)
+    {
+        switch(type)
+        {
+            case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_BOOL_VEC2: return 8;
+            case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_BOOL_VEC3: return 12;
+            case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_BOOL_VEC4: case GL_FLOAT_MAT2: return 16;
+            case GL_FLOAT_MAT3: return 36;
+            case GL_FLOAT_MAT4: return 64;
+            default: return 4; // scalars and samplers
+        }
+    }
     // utility function for checking shader compilation/linking errors.
     // ------------------------------------------------------------------------
     void checkCompileErrors(GLuint shader, std::string type)
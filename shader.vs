@@ -1,8 +1,11 @@
 #version 330 core
 layout (location = 0) in vec3 aPos;
+layout (std140) uniform Camera
+{
+    mat4 view;
+    mat4 projection;
+};
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
 void main()
 {
    gl_Position = projection * view * model * vec4(aPos.x, aPos.y, aPos.z, 1.0);
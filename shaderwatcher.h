@@ -0,0 +1,250 @@
+#ifndef SHADERWATCHER_H
+#define SHADERWATCHER_H
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include "shader.h"
+
+// reloads Shaders when their source files change on disk. a background
+// thread waits for changes (inotify on Linux, polling file times elsewhere)
+// and reads the new sources; applyPending(), called by the render loop
+// between frames, compiles them on the GL thread and swaps the program in.
+// a shader that fails to compile or link keeps its previous program
+// ------------------------------------------------------------------------
+class ShaderWatcher
+{
+public:
+    ~ShaderWatcher()
+    {
+        stop();
+    }
+
+    // register before start(); the shader must outlive the watcher
+    void watch(Shader &shader)
+    {
+        Entry entry;
+        entry.shader = &shader;
+        entry.files.push_back(shader.vertexFile);
+        entry.files.push_back(shader.fragmentFile);
+        if(!shader.geometryFile.empty())
+            entry.files.push_back(shader.geometryFile);
+        entries.push_back(entry);
+    }
+
+    void start()
+    {
+        if(running.exchange(true))
+            return;
+        worker = std::thread(&ShaderWatcher::run, this);
+    }
+
+    void stop()
+    {
+        if(!running.exchange(false))
+            return;
+        worker.join();
+    }
+
+    // GL thread, at a frame boundary: rebuild every shader whose sources
+    // changed since the last call. returns how many were swapped
+    // ------------------------------------------------------------------------
+    int applyPending()
+    {
+        std::map<size_t, Sources> ready;
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            if(pending.empty())
+                return 0;
+            ready.swap(pending);
+        }
+
+        int swapped = 0;
+        for(std::map<size_t, Sources>::iterator it = ready.begin(); it != ready.end(); ++it){
+            Shader &shader = *entries[it->first].shader;
+            if(shader.reload(it->second.vertex, it->second.fragment, it->second.geometry)){
+                std::cout << "SHADER::RELOADED: " << shader.vertexFile << " + " << shader.fragmentFile << std::endl;
+                swapped++;
+            }
+            else{
+                std::cout << "ERROR::SHADER::RELOAD_FAILED: " << shader.vertexFile << " + " << shader.fragmentFile << ", keeping the previous program" << std::endl;
+            }
+        }
+        return swapped;
+    }
+
+private:
+    struct Entry
+    {
+        Shader *shader;
+        std::vector<std::string> files;
+    };
+    struct Sources
+    {
+        std::string vertex;
+        std::string fragment;
+        std::string geometry;
+    };
+
+    // editors often save in several steps; wait this long after a change
+    // before reading so we see the finished file
+    static const int SETTLE_MS = 50;
+
+    std::vector<Entry> entries;
+    std::thread worker;
+    std::atomic<bool> running{false};
+
+    std::mutex pendingMutex;
+    std::map<size_t, Sources> pending;
+
+    static bool readFile(const std::string &path, std::string &out)
+    {
+        std::ifstream file(path);
+        if(!file)
+            return false;
+        std::stringstream stream;
+        stream << file.rdbuf();
+        out = stream.str();
+        return !out.empty();
+    }
+
+    // worker thread: queue fresh sources for every shader using one of files
+    // ------------------------------------------------------------------------
+    void changed(const std::set<std::string> &files)
+    {
+        for(size_t i = 0; i < entries.size(); i++){
+            const Entry &entry = entries[i];
+            bool affected = false;
+            for(const std::string &file : entry.files)
+                affected = affected || files.count(std::filesystem::path(file).lexically_normal().string()) > 0;
+            if(!affected)
+                continue;
+
+            Sources sources;
+            bool complete = readFile(entry.files[0], sources.vertex) && readFile(entry.files[1], sources.fragment);
+            if(complete && entry.files.size() > 2)
+                complete = readFile(entry.files[2], sources.geometry);
+            if(!complete)
+                continue;
+
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            pending[i] = sources;
+        }
+    }
+
+#ifdef __linux__
+    // watch the directories rather than the files: most editors save by
+    // writing a new file and renaming it over the old one
+    // ------------------------------------------------------------------------
+    void run()
+    {
+        int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if(fd < 0){
+            std::cout << "ERROR::SHADER_WATCHER: inotify unavailable, falling back to polling" << std::endl;
+            runPolling();
+            return;
+        }
+
+        std::map<int, std::filesystem::path> directories;
+        std::set<std::string> watched;
+        for(const Entry &entry : entries){
+            for(const std::string &file : entry.files){
+                std::filesystem::path directory = std::filesystem::path(file).parent_path();
+                if(directory.empty())
+                    directory = ".";
+                if(!watched.insert(directory.string()).second)
+                    continue;
+                int wd = inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+                if(wd < 0)
+                    std::cout << "ERROR::SHADER_WATCHER: Could not watch " << directory << std::endl;
+                else
+                    directories[wd] = directory;
+            }
+        }
+
+        alignas(inotify_event) char buffer[4096];
+        std::set<std::string> files;
+        while(running){
+            pollfd descriptor = { fd, POLLIN, 0 };
+            if(poll(&descriptor, 1, 100) <= 0)
+                continue;
+
+            // collect this burst of events, then let the writes settle
+            files.clear();
+            for(int round = 0; round < 2; round++){
+                ssize_t length;
+                while((length = read(fd, buffer, sizeof(buffer))) > 0){
+                    for(char *p = buffer; p < buffer + length; ){
+                        inotify_event *event = (inotify_event*)p;
+                        if(event->len > 0 && directories.count(event->wd)){
+                            std::filesystem::path path = directories[event->wd] / event->name;
+                            files.insert(path.lexically_normal().string());
+                        }
+                        p += sizeof(inotify_event) + event->len;
+                    }
+                }
+                if(round == 0)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(SETTLE_MS));
+            }
+            if(!files.empty())
+                changed(files);
+        }
+        close(fd);
+    }
+#else
+    void run()
+    {
+        runPolling();
+    }
+#endif
+
+    // portable fallback: compare modification times a few times a second
+    // ------------------------------------------------------------------------
+    void runPolling()
+    {
+        std::map<std::string, std::filesystem::file_time_type> stamps;
+        std::set<std::string> files;
+        bool first = true;
+        while(running){
+            files.clear();
+            for(const Entry &entry : entries){
+                for(const std::string &file : entry.files){
+                    std::error_code error;
+                    std::filesystem::file_time_type stamp = std::filesystem::last_write_time(file, error);
+                    if(error)
+                        continue;
+                    std::map<std::string, std::filesystem::file_time_type>::iterator known = stamps.find(file);
+                    if(known != stamps.end() && known->second == stamp)
+                        continue;
+                    stamps[file] = stamp;
+                    if(!first)
+                        files.insert(std::filesystem::path(file).lexically_normal().string());
+                }
+            }
+            first = false;
+            if(!files.empty()){
+                std::this_thread::sleep_for(std::chrono::milliseconds(SETTLE_MS));
+                changed(files);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(250));
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include "world.h"
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "snapshots are stored little-endian and copied in place; add byte swapping for big-endian hosts"
+#endif
+
+// a World's complete state in one flat byte buffer: a fixed header followed
+// by the arrays exactly as World stores them, so taking and restoring a
+// snapshot is a handful of memcpys (well under a microsecond for the
+// built-in level). cheap enough to take every tick, for rewind, rollback
+// and restarting a benchmark scenario without rebuilding the World. all
+// values little-endian, every section 4-byte aligned
+//
+//   balls     Ball[ballCount]                 dense, as the pool keeps them
+//   owners    uint32[ballCount]               dense position -> slot
+//   slots     {generation, dense}[slotCount]  the pool's slot table
+//   x, y      float[padded]                   target centres
+//   active    uint32[words]                   one bit per target
+//   hits      uint8[padded]                   hit points
+// ------------------------------------------------------------------------
+struct SnapshotHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t tick;
+    uint64_t seed;
+    uint64_t randomState;
+    float paddleX;
+    float paddleY;
+    float paddleVelocity;
+    int32_t score;
+    uint32_t ballCount;
+    uint32_t ballSlotCount;
+    uint32_t ballFreeHead;
+    uint32_t targetCount;
+    uint32_t paddedCount;
+    uint32_t byteSize;
+};
+
+static_assert(sizeof(SnapshotHeader) == 72, "snapshot header layout");
+static_assert(sizeof(Ball) == 16, "snapshot ball layout");
+static_assert(sizeof(EntityPool<Ball>::Slot) == 8, "snapshot slot layout");
+
+const uint32_t SNAPSHOT_MAGIC = 0x4E535353; // "SSSN"
+const uint32_t SNAPSHOT_VERSION = 1;
+
+inline size_t snapshotSize(uint32_t ballCount, uint32_t slotCount, uint32_t paddedCount)
+{
+    size_t words = (paddedCount + 31) / 32;
+    return sizeof(SnapshotHeader) + ballCount * (sizeof(Ball) + sizeof(uint32_t)) + slotCount * sizeof(EntityPool<Ball>::Slot)
+         + paddedCount * 2 * sizeof(float) + words * sizeof(uint32_t) + paddedCount;
+}
+
+// write world into out, resized to fit (reusing its storage, so taking a
+// snapshot every tick into the same buffer never allocates)
+// ------------------------------------------------------------------------
+inline void saveSnapshot(const World &world, std::vector<uint8_t> &out)
+{
+    SnapshotHeader header;
+    header.magic = SNAPSHOT_MAGIC;
+    header.version = SNAPSHOT_VERSION;
+    header.tick = world.tick;
+    header.seed = world.seed;
+    header.randomState = world.randomState;
+    header.paddleX = world.paddleX;
+    header.paddleY = world.paddleY;
+    header.paddleVelocity = world.paddleVelocity;
+    header.score = world.score;
+    header.ballCount = (uint32_t)world.balls.size();
+    header.ballSlotCount = (uint32_t)world.balls.slotCount();
+    header.ballFreeHead = world.balls.freeListHead();
+    header.targetCount = (uint32_t)world.targets.size();
+    header.paddedCount = (uint32_t)world.targets.x.size();
+    header.byteSize = (uint32_t)snapshotSize(header.ballCount, header.ballSlotCount, header.paddedCount);
+
+    out.resize(header.byteSize);
+    uint8_t *cursor = out.data();
+    size_t padded = header.paddedCount;
+    std::memcpy(cursor, &header, sizeof(header));
+    cursor += sizeof(header);
+    std::memcpy(cursor, world.balls.data(), header.ballCount * sizeof(Ball));
+    cursor += header.ballCount * sizeof(Ball);
+    std::memcpy(cursor, world.balls.ownerData(), header.ballCount * sizeof(uint32_t));
+    cursor += header.ballCount * sizeof(uint32_t);
+    std::memcpy(cursor, world.balls.slotData(), header.ballSlotCount * sizeof(EntityPool<Ball>::Slot));
+    cursor += header.ballSlotCount * sizeof(EntityPool<Ball>::Slot);
+    std::memcpy(cursor, world.targets.x.data(), padded * sizeof(float));
+    cursor += padded * sizeof(float);
+    std::memcpy(cursor, world.targets.y.data(), padded * sizeof(float));
+    cursor += padded * sizeof(float);
+    std::memcpy(cursor, world.targets.active.data(), world.targets.active.size() * sizeof(uint32_t));
+    cursor += world.targets.active.size() * sizeof(uint32_t);
+    std::memcpy(cursor, world.targets.hitPoints.data(), padded);
+}
+
+// put world back into the state of a snapshot (data 4-byte aligned, as
+// any heap buffer is); false (world untouched) if the buffer is not a
+// complete snapshot of this version. targets whose positions match the
+// snapshot's only get their hit points and active flags back
+// (activeVersion bumped); anything else is replaced as a new layout
+// (layoutVersion bumped too, so the grid and the renderer rebuild)
+// ------------------------------------------------------------------------
+inline bool restoreSnapshot(World &world, const uint8_t *data, size_t size)
+{
+    SnapshotHeader header;
+    if(size < sizeof(header)){
+        std::cout << "ERROR::SNAPSHOT: Buffer too small for a snapshot" << std::endl;
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if(header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION){
+        std::cout << "ERROR::SNAPSHOT: Not a version " << SNAPSHOT_VERSION << " snapshot" << std::endl;
+        return false;
+    }
+    if(header.paddedCount % TargetField::LANES != 0 || header.targetCount > header.paddedCount
+       || header.byteSize != snapshotSize(header.ballCount, header.ballSlotCount, header.paddedCount) || size < header.byteSize){
+        std::cout << "ERROR::SNAPSHOT: Snapshot is truncated or corrupt" << std::endl;
+        return false;
+    }
+
+    const uint8_t *cursor = data + sizeof(header);
+    size_t padded = header.paddedCount;
+    const Ball *balls = (const Ball*)cursor;
+    cursor += header.ballCount * sizeof(Ball);
+    const uint32_t *owners = (const uint32_t*)cursor;
+    cursor += header.ballCount * sizeof(uint32_t);
+    const EntityPool<Ball>::Slot *slots = (const EntityPool<Ball>::Slot*)cursor;
+    cursor += header.ballSlotCount * sizeof(EntityPool<Ball>::Slot);
+    const float *xs = (const float*)cursor;
+    cursor += padded * sizeof(float);
+    const float *ys = (const float*)cursor;
+    cursor += padded * sizeof(float);
+    const uint32_t *activeWords = (const uint32_t*)cursor;
+    cursor += (padded + 31) / 32 * sizeof(uint32_t);
+    const uint8_t *hits = cursor;
+
+    // a pool restored from a bad slot table would hand out wild indices or
+    // live slots on the next spawn. each live slot must point back at its
+    // dense position, and the free list must run through every other slot
+    // exactly once: a chain that ends after slotCount - ballCount links,
+    // none of them live, cannot revisit a slot
+    bool validPool = header.ballCount <= header.ballSlotCount;
+    for(uint32_t i = 0; validPool && i < header.ballCount; i++)
+        validPool = owners[i] < header.ballSlotCount && slots[owners[i]].dense == i;
+    uint32_t freeSlots = 0;
+    uint32_t link = header.ballFreeHead;
+    while(validPool && link != EntityHandle::INVALID_INDEX){
+        validPool = link < header.ballSlotCount && freeSlots < header.ballSlotCount - header.ballCount;
+        if(!validPool)
+            break;
+        uint32_t next = slots[link].dense;
+        validPool = !(next < header.ballCount && owners[next] == link);
+        freeSlots += 1;
+        link = next;
+    }
+    validPool = validPool && header.ballCount + freeSlots == header.ballSlotCount;
+    if(!validPool){
+        std::cout << "ERROR::SNAPSHOT: Snapshot is truncated or corrupt" << std::endl;
+        return false;
+    }
+
+    world.tick = header.tick;
+    world.seed = header.seed;
+    world.randomState = header.randomState;
+    world.paddleX = header.paddleX;
+    world.paddleY = header.paddleY;
+    world.paddleVelocity = header.paddleVelocity;
+    world.score = header.score;
+    world.balls.restore(balls, owners, header.ballCount, slots, header.ballSlotCount, header.ballFreeHead);
+
+    TargetField &targets = world.targets;
+    bool sameLayout = targets.size() == header.targetCount && targets.x.size() == padded
+                   && std::memcmp(targets.x.data(), xs, padded * sizeof(float)) == 0
+                   && std::memcmp(targets.y.data(), ys, padded * sizeof(float)) == 0;
+    if(sameLayout)
+        targets.assignState(hits, activeWords);
+    else
+        targets.assign(header.targetCount, xs, ys, hits, activeWords);
+    return true;
+}
+
+inline bool restoreSnapshot(World &world, const std::vector<uint8_t> &snapshot)
+{
+    return restoreSnapshot(world, snapshot.data(), snapshot.size());
+}
+
+#endif
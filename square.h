@@ -1,5 +1,7 @@
-extern int SCORE;
+#ifndef SQUARE_H
+#define SQUARE_H
 
+// one target of a level layout; x and y are the centre of its 1x1 box
 class Square {
     public:
 
@@ -24,42 +26,10 @@ class Square {
         void setIsActive(bool isActive) {active = isActive;}
 
         //getters
-        float getX() {return squareX;}
-        float getY() {return squareY;}
-        float getZ() {return squareZ;}
-        bool getActive() {return active;}
+        float getX() const {return squareX;}
+        float getY() const {return squareY;}
+        float getZ() const {return squareZ;}
+        bool getActive() const {return active;}
+};
 
-
-        bool checkCollisionTarget(Square targetSquare, float squareX, float squareY, float circleX, float circleY){
-
-            float circleRadius = 0.5f;
-        
-            glm::vec2 center(circleX + circleRadius, circleY + circleRadius);
-        
-            // targetSquares have a width of 1.0f and height of 1.0f
-        
-            float targetX = targetSquare.getX(); 
-            float targetY = targetSquare.getY();
-        
-            glm::vec2 aabb_half_extents(0.5f, 0.5f);
-            glm::vec2 aabb_center(
-                targetX + aabb_half_extents.x, 
-                targetY + aabb_half_extents.y
-            );
-        
-            glm::vec2 difference = center - aabb_center;
-            glm::vec2 clamped = glm::clamp(difference, -aabb_half_extents, aabb_half_extents);
-        
-            glm::vec2 closest = aabb_center + clamped;
-        
-            difference = closest - center;
-        
-            if(glm::length(difference) < circleRadius){
-                SCORE += 1;
-            }
-        
-            return glm::length(difference) < circleRadius;
-        
-        }
-        
-};
\ No newline at end of file
+#endif
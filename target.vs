@@ -0,0 +1,17 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in float aTargetX; // per instance, TargetField::x
+layout (location = 2) in float aTargetY; // per instance, TargetField::y
+layout (std140) uniform Camera
+{
+    mat4 view;
+    mat4 projection;
+};
+uniform usamplerBuffer activeBits; // TargetField::active, one bit per target
+void main()
+{
+   uint word = texelFetch(activeBits, gl_InstanceID >> 5).r;
+   float active = float((word >> uint(gl_InstanceID & 31)) & 1u);
+   // destroyed targets collapse to a single point and produce no fragments
+   gl_Position = projection * view * vec4(aPos * active + vec3(aTargetX, aTargetY, 0.0), 1.0);
+}
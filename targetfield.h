@@ -0,0 +1,279 @@
+#ifndef TARGETFIELD_H
+#define TARGETFIELD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// allocator that hands out SIMD-aligned blocks so the kernels below can use
+// aligned loads on TargetField's arrays
+// ------------------------------------------------------------------------
+template <typename T, std::size_t Alignment>
+struct AlignedAllocator
+{
+    typedef T value_type;
+
+    template <typename U> struct rebind { typedef AlignedAllocator<U, Alignment> other; };
+
+    AlignedAllocator() {}
+    template <typename U> AlignedAllocator(const AlignedAllocator<U, Alignment> &) {}
+
+    T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+    void deallocate(T *p, std::size_t)
+    {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template <typename U> bool operator==(const AlignedAllocator<U, Alignment> &) const { return true; }
+    template <typename U> bool operator!=(const AlignedAllocator<U, Alignment> &) const { return false; }
+};
+
+// all targets of a level stored as structure-of-arrays: x[] and y[] hold the
+// centres, one bit per target in active[] says whether it is still alive and
+// hitPoints[] how many more hits it takes.
+// arrays are padded to a multiple of 8 so the collision kernel always works
+// on full lanes, and x/y/active are laid out exactly as the renderer uploads
+// them (two float streams plus a GL_R32UI texture buffer)
+// ------------------------------------------------------------------------
+class TargetField
+{
+public:
+    // targets are 1.0f x 1.0f squares centred on their position
+    static constexpr float HALF_EXTENT = 0.5f;
+    static const std::size_t LANES = 8;
+
+    typedef std::vector<float, AlignedAllocator<float, 32> > FloatArray;
+
+    FloatArray x;
+    FloatArray y;
+    std::vector<uint32_t> active;
+    std::vector<uint8_t> hitPoints;
+
+    // bumped when targets are added/removed (positions change) and when one
+    // is destroyed, so the renderer can re-upload just what changed
+    unsigned int layoutVersion = 0;
+    unsigned int activeVersion = 0;
+
+    std::size_t size() const { return count; }
+
+    void clear()
+    {
+        count = 0;
+        x.clear();
+        y.clear();
+        active.clear();
+        hitPoints.clear();
+        layoutVersion += 1;
+    }
+
+    void reserve(std::size_t n)
+    {
+        std::size_t padded = (n + LANES - 1) / LANES * LANES;
+        x.reserve(padded);
+        y.reserve(padded);
+        active.reserve((padded + 31) / 32);
+        hitPoints.reserve(padded);
+    }
+
+    void add(float targetX, float targetY, bool alive, uint8_t hits = 1)
+    {
+        std::size_t index = count++;
+        resizePadded();
+        x[index] = targetX;
+        y[index] = targetY;
+        hitPoints[index] = hits;
+        setActive(index, alive);
+        layoutVersion += 1;
+    }
+
+    // replace every target with n copied from arrays laid out like the
+    // members: xs/ys/hits padded to a multiple of LANES (padding positions
+    // far outside the level), activeWords one bit per target. bulk copies
+    // only, so a mapped level file loads without touching single targets
+    // ------------------------------------------------------------------------
+    void assign(std::size_t n, const float *xs, const float *ys, const uint8_t *hits, const uint32_t *activeWords)
+    {
+        std::size_t padded = (n + LANES - 1) / LANES * LANES;
+        std::size_t words = (padded + 31) / 32;
+        count = n;
+        x.assign(xs, xs + padded);
+        y.assign(ys, ys + padded);
+        hitPoints.assign(hits, hits + padded);
+        active.assign(activeWords, activeWords + words);
+        // no bits past the last target, whatever the source had there
+        if(n % 32 != 0)
+            active[n / 32] &= (1u << (n % 32)) - 1u;
+        for(std::size_t w = (n + 31) / 32; w < words; w++)
+            active[w] = 0u;
+        layoutVersion += 1;
+        activeVersion += 1;
+    }
+
+    // replace hit points and active flags (laid out like the members) of
+    // the current targets, keeping their positions
+    void assignState(const uint8_t *hits, const uint32_t *activeWords)
+    {
+        hitPoints.assign(hits, hits + hitPoints.size());
+        active.assign(activeWords, activeWords + active.size());
+        activeVersion += 1;
+    }
+
+    // one hit on a target; true if that destroyed it
+    bool hit(std::size_t index)
+    {
+        if(hitPoints[index] > 1){
+            hitPoints[index] -= 1;
+            return false;
+        }
+        hitPoints[index] = 0;
+        setActive(index, false);
+        return true;
+    }
+
+    bool isActive(std::size_t index) const
+    {
+        return (active[index >> 5] >> (index & 31)) & 1u;
+    }
+
+    void setActive(std::size_t index, bool alive)
+    {
+        if(alive)
+            active[index >> 5] |= 1u << (index & 31);
+        else
+            active[index >> 5] &= ~(1u << (index & 31));
+        activeVersion += 1;
+    }
+
+    std::size_t activeCount() const
+    {
+        std::size_t total = 0;
+        for(uint32_t word : active)
+            total += (std::size_t)__builtin_popcount(word);
+        return total;
+    }
+
+    // append the indices of all active targets overlapping the circle, in
+    // ascending order. whole words of destroyed targets are skipped, the rest
+    // is tested 8 targets at a time
+    // ------------------------------------------------------------------------
+    void overlapCircle(float cx, float cy, float radius, std::vector<unsigned int> &out) const
+    {
+        out.clear();
+        for(std::size_t w = 0; w < active.size(); w++){
+            uint32_t word = active[w];
+            while(word != 0){
+                // lowest live group of 8 in this word
+                unsigned int group = (unsigned int)__builtin_ctz(word) >> 3;
+                std::size_t base = w * 32 + group * 8;
+                uint32_t live = (word >> (group * 8)) & 0xFFu;
+                uint32_t hits = overlapMask8(base, cx, cy, radius) & live;
+                while(hits != 0){
+                    unsigned int lane = (unsigned int)__builtin_ctz(hits);
+                    out.push_back((unsigned int)(base + lane));
+                    hits &= hits - 1;
+                }
+                word &= ~(0xFFu << (group * 8));
+            }
+        }
+    }
+
+    // bit i set if target base + i overlaps the circle (ignores active flags)
+    // ------------------------------------------------------------------------
+    uint32_t overlapMask8(std::size_t base, float cx, float cy, float radius) const
+    {
+        const float *px = x.data() + base;
+        const float *py = y.data() + base;
+#if defined(__AVX2__)
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+        __m256 half = _mm256_set1_ps(HALF_EXTENT);
+        __m256 zero = _mm256_setzero_ps();
+        __m256 dx = _mm256_andnot_ps(signMask, _mm256_sub_ps(_mm256_load_ps(px), _mm256_set1_ps(cx)));
+        __m256 dy = _mm256_andnot_ps(signMask, _mm256_sub_ps(_mm256_load_ps(py), _mm256_set1_ps(cy)));
+        dx = _mm256_max_ps(_mm256_sub_ps(dx, half), zero);
+        dy = _mm256_max_ps(_mm256_sub_ps(dy, half), zero);
+        __m256 d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        __m256 hit = _mm256_cmp_ps(d2, _mm256_set1_ps(radius * radius), _CMP_LT_OQ);
+        return (uint32_t)_mm256_movemask_ps(hit);
+#elif defined(__SSE2__)
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        __m128 half = _mm_set1_ps(HALF_EXTENT);
+        __m128 zero = _mm_setzero_ps();
+        __m128 vcx = _mm_set1_ps(cx);
+        __m128 vcy = _mm_set1_ps(cy);
+        __m128 r2 = _mm_set1_ps(radius * radius);
+        uint32_t mask = 0;
+        for(int k = 0; k < 2; k++){
+            __m128 dx = _mm_andnot_ps(signMask, _mm_sub_ps(_mm_load_ps(px + k * 4), vcx));
+            __m128 dy = _mm_andnot_ps(signMask, _mm_sub_ps(_mm_load_ps(py + k * 4), vcy));
+            dx = _mm_max_ps(_mm_sub_ps(dx, half), zero);
+            dy = _mm_max_ps(_mm_sub_ps(dy, half), zero);
+            __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            mask |= (uint32_t)_mm_movemask_ps(_mm_cmplt_ps(d2, r2)) << (k * 4);
+        }
+        return mask;
+#elif defined(__ARM_NEON)
+        float32x4_t half = vdupq_n_f32(HALF_EXTENT);
+        float32x4_t zero = vdupq_n_f32(0.0f);
+        float32x4_t vcx = vdupq_n_f32(cx);
+        float32x4_t vcy = vdupq_n_f32(cy);
+        float32x4_t r2 = vdupq_n_f32(radius * radius);
+        const uint32_t laneBits[4] = { 1u, 2u, 4u, 8u };
+        uint32x4_t bits = vld1q_u32(laneBits);
+        uint32_t mask = 0;
+        for(int k = 0; k < 2; k++){
+            float32x4_t dx = vabsq_f32(vsubq_f32(vld1q_f32(px + k * 4), vcx));
+            float32x4_t dy = vabsq_f32(vsubq_f32(vld1q_f32(py + k * 4), vcy));
+            dx = vmaxq_f32(vsubq_f32(dx, half), zero);
+            dy = vmaxq_f32(vsubq_f32(dy, half), zero);
+            float32x4_t d2 = vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy));
+            uint32x4_t hit = vandq_u32(vcltq_f32(d2, r2), bits);
+            mask |= (uint32_t)vaddvq_u32(hit) << (k * 4);
+        }
+        return mask;
+#else
+        uint32_t mask = 0;
+        for(std::size_t lane = 0; lane < LANES; lane++){
+            float dx = px[lane] - cx;
+            float dy = py[lane] - cy;
+            dx = dx < 0.0f ? -dx : dx;
+            dy = dy < 0.0f ? -dy : dy;
+            dx = dx > HALF_EXTENT ? dx - HALF_EXTENT : 0.0f;
+            dy = dy > HALF_EXTENT ? dy - HALF_EXTENT : 0.0f;
+            if(dx * dx + dy * dy < radius * radius)
+                mask |= 1u << lane;
+        }
+        return mask;
+#endif
+    }
+
+private:
+    std::size_t count = 0;
+
+    // keep x/y a multiple of LANES long; padding sits far outside any level
+    void resizePadded()
+    {
+        std::size_t padded = (count + LANES - 1) / LANES * LANES;
+        if(x.size() < padded){
+            x.resize(padded, 1e30f);
+            y.resize(padded, 1e30f);
+            hitPoints.resize(padded, 0);
+        }
+        std::size_t words = (padded + 31) / 32;
+        if(active.size() < words)
+            active.resize(words, 0u);
+    }
+};
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef TARGETGRID_H
+#define TARGETGRID_H
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "targetfield.h"
+
+// static uniform grid over the targets, used as the broadphase for ball vs
+// target collision. targets never move, so the grid is built once per level
+// into a compact cell -> target index table (counting sort, no per-cell
+// allocations) and queried with the ball's swept bounding box
+// ------------------------------------------------------------------------
+class TargetGrid
+{
+public:
+    static constexpr float TARGET_HALF_EXTENT = TargetField::HALF_EXTENT;
+
+    void build(const TargetField &targets)
+    {
+        targetCount = targets.size();
+        cellStart.clear();
+        cellItems.clear();
+        stamps.assign(targetCount, 0);
+        queryStamp = 0;
+
+        if(targetCount == 0){
+            cols = rows = 0;
+            return;
+        }
+
+        float minX = targets.x[0], maxX = minX;
+        float minY = targets.y[0], maxY = minY;
+        for(size_t i = 1; i < targetCount; i++){
+            minX = std::min(minX, targets.x[i]);
+            maxX = std::max(maxX, targets.x[i]);
+            minY = std::min(minY, targets.y[i]);
+            maxY = std::max(maxY, targets.y[i]);
+        }
+        originX = minX - TARGET_HALF_EXTENT;
+        originY = minY - TARGET_HALF_EXTENT;
+        float width = (maxX - minX) + 2.0f * TARGET_HALF_EXTENT;
+        float height = (maxY - minY) + 2.0f * TARGET_HALF_EXTENT;
+
+        // aim for about one target per cell, but never smaller than a target
+        cellSize = std::max(2.0f * TARGET_HALF_EXTENT, std::sqrt(width * height / (float)targetCount));
+        cols = std::max(1, (int)std::ceil(width / cellSize));
+        rows = std::max(1, (int)std::ceil(height / cellSize));
+
+        // count, prefix-sum, then scatter target indices into their cells
+        cellStart.assign((size_t)cols * rows + 1, 0);
+        for(size_t i = 0; i < targetCount; i++)
+            forEachCell(targets.x[i], targets.y[i], [&](size_t cell){ cellStart[cell + 1]++; });
+        for(size_t c = 1; c < cellStart.size(); c++)
+            cellStart[c] += cellStart[c - 1];
+
+        cellItems.resize(cellStart.back());
+        std::vector<unsigned int> fill(cellStart.begin(), cellStart.end() - 1);
+        for(size_t i = 0; i < targetCount; i++)
+            forEachCell(targets.x[i], targets.y[i], [&](size_t cell){ cellItems[fill[cell]++] = (unsigned int)i; });
+    }
+
+    size_t size() const { return targetCount; }
+
+    // indices of every target whose cells touch the box, ascending and without
+    // duplicates so callers visit them in the same order as a linear scan
+    // ------------------------------------------------------------------------
+    void query(float minX, float minY, float maxX, float maxY, std::vector<unsigned int> &out) const
+    {
+        out.clear();
+        if(targetCount == 0)
+            return;
+
+        int x0, y0, x1, y1;
+        if(!cellRange(minX, minY, maxX, maxY, x0, y0, x1, y1))
+            return;
+
+        // stamps de-duplicate targets that straddle several cells
+        if(++queryStamp == 0){
+            std::fill(stamps.begin(), stamps.end(), 0);
+            queryStamp = 1;
+        }
+
+        for(int y = y0; y <= y1; y++){
+            for(int x = x0; x <= x1; x++){
+                size_t cell = (size_t)y * cols + x;
+                for(unsigned int k = cellStart[cell]; k < cellStart[cell + 1]; k++){
+                    unsigned int index = cellItems[k];
+                    if(stamps[index] != queryStamp){
+                        stamps[index] = queryStamp;
+                        out.push_back(index);
+                    }
+                }
+            }
+        }
+        std::sort(out.begin(), out.end());
+    }
+
+private:
+    size_t targetCount = 0;
+    float originX = 0.0f;
+    float originY = 0.0f;
+    float cellSize = 1.0f;
+    int cols = 0;
+    int rows = 0;
+    std::vector<unsigned int> cellStart;
+    std::vector<unsigned int> cellItems;
+    mutable std::vector<unsigned int> stamps;
+    mutable unsigned int queryStamp = 0;
+
+    // clamp a world-space box to the cells it covers; false if fully outside
+    bool cellRange(float minX, float minY, float maxX, float maxY, int &x0, int &y0, int &x1, int &y1) const
+    {
+        float fx0 = std::floor((minX - originX) / cellSize);
+        float fy0 = std::floor((minY - originY) / cellSize);
+        float fx1 = std::floor((maxX - originX) / cellSize);
+        float fy1 = std::floor((maxY - originY) / cellSize);
+        if(fx1 < 0.0f || fy1 < 0.0f || fx0 >= (float)cols || fy0 >= (float)rows)
+            return false;
+        x0 = std::max(0, (int)fx0);
+        y0 = std::max(0, (int)fy0);
+        x1 = std::min(cols - 1, (int)fx1);
+        y1 = std::min(rows - 1, (int)fy1);
+        return true;
+    }
+
+    template <typename Fn>
+    void forEachCell(float targetX, float targetY, Fn fn) const
+    {
+        int x0, y0, x1, y1;
+        if(!cellRange(targetX - TARGET_HALF_EXTENT, targetY - TARGET_HALF_EXTENT,
+                      targetX + TARGET_HALF_EXTENT, targetY + TARGET_HALF_EXTENT,
+                      x0, y0, x1, y1))
+            return;
+        for(int y = y0; y <= y1; y++)
+            for(int x = x0; x <= x1; x++)
+                fn((size_t)y * cols + x);
+    }
+};
+
+#endif
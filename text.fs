@@ -2,11 +2,29 @@
 in vec2 TexCoords;
 out vec4 color;
 
+// distance field atlas: 0.5 on the glyph edge, rising inside, falling outside
 uniform sampler2D text;
 uniform vec3 textColor;
+uniform vec4 outlineColor;
+uniform float outlineWidth;   // in field units, 0 for none
+uniform vec4 shadowColor;
+uniform vec2 shadowOffset;    // in texture coordinates
 
 void main()
-{    
-    vec4 sampled = vec4(1.0, 1.0, 1.0, texture(text, TexCoords).r);
-    color = vec4(textColor, 1.0) * sampled;
-}
\ No newline at end of file
+{
+    float distance = texture(text, TexCoords).r;
+    // antialias across about one screen pixel, whatever size the text is drawn at
+    float smoothing = max(fwidth(distance) * 0.7, 0.001);
+
+    float fill = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+    float edge = 0.5 - outlineWidth;
+    float outline = smoothstep(edge - smoothing, edge + smoothing, distance) * outlineColor.a;
+    float shadowDistance = texture(text, TexCoords - shadowOffset).r;
+    float shadow = smoothstep(edge - smoothing, edge + smoothing, shadowDistance) * shadowColor.a;
+
+    // premultiplied: text over outline over shadow
+    vec4 result = vec4(textColor * fill, fill);
+    result += vec4(outlineColor.rgb * outline, outline) * (1.0 - result.a);
+    result += vec4(shadowColor.rgb * shadow, shadow) * (1.0 - result.a);
+    color = vec4(result.rgb / max(result.a, 0.001), result.a);
+}
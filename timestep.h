@@ -0,0 +1,51 @@
+#ifndef TIMESTEP_H
+#define TIMESTEP_H
+
+// accumulator for running a fixed-rate simulation under a variable-rate render
+// loop: feed it the wall-clock time of each frame, run the returned number of
+// ticks, then draw with alpha() as the blend between the last two ticks
+// ------------------------------------------------------------------------
+class FixedTimestep
+{
+public:
+    double dt;
+
+    // maxFrameTime caps how much time a single slow frame may feed in, so a
+    // stall (window drag, breakpoint) does not queue up seconds of ticks
+    FixedTimestep(double tickRate, double maxFrameTime = 0.25)
+    {
+        dt = 1.0 / tickRate;
+        maxFrame = maxFrameTime;
+        accumulator = 0.0;
+    }
+
+    // add elapsed frame time and return how many ticks are due
+    int advance(double frameTime)
+    {
+        if(frameTime > maxFrame)
+            frameTime = maxFrame;
+        if(frameTime < 0.0)
+            frameTime = 0.0;
+
+        accumulator += frameTime;
+
+        int ticks = 0;
+        while(accumulator >= dt){
+            accumulator -= dt;
+            ticks++;
+        }
+        return ticks;
+    }
+
+    // fraction of a tick left over in the accumulator, in [0, 1)
+    float alpha() const
+    {
+        return (float)(accumulator / dt);
+    }
+
+private:
+    double accumulator;
+    double maxFrame;
+};
+
+#endif
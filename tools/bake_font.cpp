@@ -0,0 +1,37 @@
+// rasterize a TrueType font into the baked distance field font cache the game maps at
+// startup (fontcache.h). the game bakes on first run by itself; this is for
+// builds without FreeType and for shipping the cache pre-made
+//
+//   bake_font [font.ttf] [output] [pixel size] [spread]
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "fontbake.h"
+#include "fontcache.h"
+
+int main(int argc, char **argv)
+{
+    std::string fontPath = argc > 1 ? argv[1] : "fonts/arial.ttf";
+    std::string outputPath = argc > 2 ? argv[2] : "fonts/arial.fontcache";
+    int pixelSize = argc > 3 ? std::atoi(argv[3]) : 32;
+    int spread = argc > 4 ? std::atoi(argv[4]) : 4;
+    if(pixelSize <= 0 || spread <= 0){
+        std::printf("usage: %s [font.ttf] [output] [pixel size] [spread]\n", argv[0]);
+        return 2;
+    }
+
+    FontAtlas atlas;
+    if(!bakeFontAtlas(fontPath, pixelSize, spread, atlas))
+        return 1;
+    if(!writeFontCache(outputPath, fontPath, atlas.pixelSize, atlas.lineHeight, atlas.spread, atlas.glyphs, atlas.pixels.data(), atlas.width, atlas.height))
+        return 1;
+
+    FontCacheFile check;
+    if(!check.open(outputPath, pixelSize, fontPath)){
+        std::printf("%s was written but does not read back\n", outputPath.c_str());
+        return 1;
+    }
+    std::printf("%s: %d px, spread %d, %dx%d atlas, line height %d\n", outputPath.c_str(), pixelSize, spread, atlas.width, atlas.height, atlas.lineHeight);
+    return 0;
+}
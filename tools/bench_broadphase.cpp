@@ -0,0 +1,147 @@
+// ball vs target broadphase benchmark: compares the TargetGrid query against a
+// scalar linear scan and the SIMD full-field sweep (TargetField::overlapCircle)
+// over levels of 10 to 1,000,000 targets and reports how the cost per query
+// scales with the target count
+//
+// g++ -std=c++17 -O2 -I. -Idependencies/include tools/bench_broadphase.cpp -o bench_broadphase
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "square.h"
+#include "targetfield.h"
+#include "targetgrid.h"
+
+// square-ish field of targets with the default level's 1.1 spacing
+static void makeLevel(size_t count, std::vector<Square> &squares, TargetField &field)
+{
+    squares.clear();
+    squares.reserve(count);
+    field.clear();
+    field.reserve(count);
+    size_t side = (size_t)std::ceil(std::sqrt((double)count));
+    for(size_t i = 0; i < count; i++){
+        squares.push_back(Square((float)(i % side) * 1.1f, (float)(i / side) * 1.1f, 0.0f, true));
+        field.add(squares.back().getX(), squares.back().getY(), true);
+    }
+}
+
+// scalar circle vs target test over the AoS Squares, same maths as the kernel
+static bool overlaps(const Square &target, float x, float y)
+{
+    float dx = std::fabs(target.getX() - x) - TargetField::HALF_EXTENT;
+    float dy = std::fabs(target.getY() - y) - TargetField::HALF_EXTENT;
+    dx = dx > 0.0f ? dx : 0.0f;
+    dy = dy > 0.0f ? dy : 0.0f;
+    return dx * dx + dy * dy < 0.5f * 0.5f;
+}
+
+// same xorshift stream for both paths so they test identical ball positions
+static float nextFloat(unsigned int &state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return (float)(state & 0xFFFFFF) / (float)0xFFFFFF;
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    const float reach = 0.5f + 0.01f;
+    std::printf("%10s %14s %14s %14s %10s %12s\n", "targets", "linear ns/q", "simd ns/q", "grid ns/q", "speedup", "grid growth");
+
+    double previousGrid = 0.0;
+    size_t previousCount = 0;
+
+    for(size_t count = 10; count <= 1000000; count *= 10)
+    {
+        std::vector<Square> targets;
+        TargetField field;
+        makeLevel(count, targets, field);
+        float extent = (float)std::ceil(std::sqrt((double)count)) * 1.1f;
+
+        TargetGrid grid;
+        grid.build(field);
+
+        // keep the linear path to a fixed amount of work so large levels finish
+        size_t linearQueries = std::max<size_t>(10, 20000000 / count);
+        size_t gridQueries = 2000000;
+
+        unsigned int state = 12345;
+        size_t linearHits = 0;
+        auto start = std::chrono::steady_clock::now();
+        for(size_t q = 0; q < linearQueries; q++){
+            float x = nextFloat(state) * extent;
+            float y = nextFloat(state) * extent;
+            for(size_t i = 0; i < targets.size(); i++){
+                const Square &target = targets[i];
+                if(overlaps(target, x, y))
+                    linearHits++;
+            }
+        }
+        double linear = secondsSince(start) * 1e9 / (double)linearQueries;
+
+        state = 12345;
+        size_t simdHits = 0;
+        std::vector<unsigned int> candidates;
+        start = std::chrono::steady_clock::now();
+        for(size_t q = 0; q < linearQueries; q++){
+            float x = nextFloat(state) * extent;
+            float y = nextFloat(state) * extent;
+            field.overlapCircle(x, y, 0.5f, candidates);
+            simdHits += candidates.size();
+        }
+        double simd = secondsSince(start) * 1e9 / (double)linearQueries;
+
+        state = 12345;
+        size_t gridHits = 0;
+        start = std::chrono::steady_clock::now();
+        for(size_t q = 0; q < gridQueries; q++){
+            float x = nextFloat(state) * extent;
+            float y = nextFloat(state) * extent;
+            grid.query(x - reach, y - reach, x + reach, y + reach, candidates);
+            for(unsigned int i : candidates){
+                const Square &target = targets[i];
+                if(overlaps(target, x, y))
+                    gridHits++;
+            }
+        }
+        double gridNs = secondsSince(start) * 1e9 / (double)gridQueries;
+
+        // sanity check: both paths must agree on the queries they share
+        state = 12345;
+        size_t checkHits = 0;
+        for(size_t q = 0; q < linearQueries; q++){
+            float x = nextFloat(state) * extent;
+            float y = nextFloat(state) * extent;
+            grid.query(x - reach, y - reach, x + reach, y + reach, candidates);
+            for(unsigned int i : candidates){
+                const Square &target = targets[i];
+                if(overlaps(target, x, y))
+                    checkHits++;
+            }
+        }
+        if(checkHits != linearHits || simdHits != linearHits){
+            std::printf("MISMATCH at %zu targets: linear %zu hits, simd %zu hits, grid %zu hits\n", count, linearHits, simdHits, checkHits);
+            return 1;
+        }
+
+        // growth exponent of the grid cost per decade: 1.0 would be linear
+        char growth[32] = "-";
+        if(previousCount != 0)
+            std::snprintf(growth, sizeof(growth), "n^%.2f", std::log(gridNs / previousGrid) / std::log((double)count / previousCount));
+
+        std::printf("%10zu %14.1f %14.1f %14.1f %9.1fx %12s\n", count, linear, simd, gridNs, linear / gridNs, growth);
+        (void)gridHits;
+
+        previousGrid = gridNs;
+        previousCount = count;
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+// entity churn benchmark: a World with a few thousand balls in play spawns
+// and destroys balls every tick (multiball, debris) while stepping, and
+// reports the cost per spawn/destroy and per ball-tick. fails (exit 1) if
+// the pool's storage moves after warm-up, i.e. if churn reaches the heap
+//
+//   bench_entities [balls] [churn per tick] [ticks]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "world.h"
+
+// same xorshift stream every run
+static uint32_t nextRandom(uint32_t &state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static float randomRange(uint32_t &state, float lo, float hi)
+{
+    return lo + (hi - lo) * (float)(nextRandom(state) & 0xFFFFFF) / (float)0xFFFFFF;
+}
+
+static EntityHandle spawnRandomBall(World &world, uint32_t &state)
+{
+    return world.spawnBall(randomRange(state, -4.0f, 4.0f), randomRange(state, -2.0f, 2.0f),
+                           randomRange(state, -3.0f, 3.0f), randomRange(state, -3.0f, 3.0f));
+}
+
+int main(int argc, char **argv)
+{
+    int ballCount = argc > 1 ? std::atoi(argv[1]) : 2000;
+    int churn = argc > 2 ? std::atoi(argv[2]) : 50;
+    int ticks = argc > 3 ? std::atoi(argv[3]) : 2000;
+    if(ballCount <= 0 || churn < 0 || churn > ballCount || ticks <= 0){
+        std::printf("usage: %s [balls] [churn per tick] [ticks]\n", argv[0]);
+        return 2;
+    }
+
+    World world;
+    world.balls.reserve((size_t)ballCount + 1);
+    uint32_t state = 0x9E3779B9u;
+    std::vector<EntityHandle> live;
+    live.reserve((size_t)ballCount);
+    for(int i = 0; i < ballCount; i++)
+        live.push_back(spawnRandomBall(world, state));
+
+    const Ball *storage = world.balls.data();
+    InputFrame input;
+    double churnNanoseconds = 0.0;
+    double stepNanoseconds = 0.0;
+    int staleResolved = 0;
+
+    for(int tick = 0; tick < ticks; tick++){
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for(int i = 0; i < churn; i++){
+            size_t victim = nextRandom(state) % live.size();
+            EntityHandle old = live[victim];
+            world.destroyBall(old);
+            live[victim] = spawnRandomBall(world, state);
+            // the new ball usually reuses the old slot; the old handle must
+            // not resolve to it
+            if(world.balls.get(old) != NULL)
+                staleResolved++;
+        }
+        std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+        world.step(input);
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+        churnNanoseconds += (double)std::chrono::duration_cast<std::chrono::nanoseconds>(middle - start).count();
+        stepNanoseconds += (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - middle).count();
+    }
+
+    double operations = (double)ticks * churn;
+    double ballTicks = (double)ticks * world.balls.size();
+    std::printf("%zu balls, %d destroy+spawn per tick, %d ticks\n", world.balls.size(), churn, ticks);
+    if(churn > 0)
+        std::printf("destroy+spawn: %.1f ns, %.2f M per second\n", churnNanoseconds / operations, operations / churnNanoseconds * 1000.0);
+    std::printf("step: %.1f ns per ball-tick\n", stepNanoseconds / ballTicks);
+
+    if(staleResolved > 0){
+        std::printf("FAIL: %d destroyed handles still resolved\n", staleResolved);
+        return 1;
+    }
+    if(world.balls.data() != storage){
+        std::printf("FAIL: ball storage was reallocated during churn\n");
+        return 1;
+    }
+    std::printf("OK: no stale handles, storage never moved\n");
+    return 0;
+}
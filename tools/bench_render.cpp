@@ -0,0 +1,114 @@
+// CPU-side cost of submitting one frame, measured against MockGL instead of
+// a driver: runs the real Renderer on the default level for a number of
+// frames and reports time per draw(), GL calls and render queue state
+// changes per frame. fails (exit 1) if any frame issues more draw calls
+// than the budget, so it can gate CI machines without a GPU. run from the
+// repository root (loads the shaders and the font cache, baking it from
+// fonts/arial.ttf if needed)
+//
+//   bench_render [frames] [draw call budget]
+
+#include <glad/glad.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "mockgl.h"
+#include "world.h"
+#include "renderer.h"
+
+// paddle (2), ball, all targets, two HUD strings and the GPU timer overlay
+const unsigned int DEFAULT_DRAW_CALL_BUDGET = 7;
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? std::atoi(argv[1]) : 10000;
+    unsigned int budget = argc > 2 ? (unsigned int)std::atoi(argv[2]) : DEFAULT_DRAW_CALL_BUDGET;
+    if(frames <= 0){
+        std::printf("usage: %s [frames] [draw call budget]\n", argv[0]);
+        return 2;
+    }
+
+    if(!gladLoadGLLoader((GLADloadproc)MockGL::getProcAddress)){
+        std::printf("Failed to initialize GLAD with the mock loader\n");
+        return 1;
+    }
+    std::printf("GL %d.%d on %s\n", GLVersion.major, GLVersion.minor, (const char*)glGetString(GL_RENDERER));
+
+    Renderer renderer(1280, 720);
+    renderer.loadFont("fonts/arial.fontcache", "fonts/arial.ttf");
+    std::printf("GPU timer queries: %s\n", renderer.gpuTimers.available() ? "available" : "unavailable");
+
+    World world;
+    InputFrame input;
+    const int ticksPerFrame = (int)(SIM_TICK_RATE / 60.0);
+
+    std::vector<double> frameNanoseconds;
+    frameNanoseconds.reserve((size_t)frames);
+    MockGLCounters sum;
+    MockGLCounters worst;
+    RenderQueueStats queueSum = RenderQueueStats();
+    int overBudget = 0;
+
+    for(int frame = 0; frame < frames; frame++){
+        // wiggle the paddle so the uniform filter sees real changes
+        input.up = (frame / 30) % 2 == 0;
+        input.down = !input.up;
+        for(int tick = 0; tick < ticksPerFrame; tick++)
+            world.step(input);
+
+        MockGL::reset();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        renderer.draw(world, world.motion());
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        frameNanoseconds.push_back((double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+        const RenderQueueStats &q = renderer.queueStats();
+        queueSum.commands += q.commands;
+        queueSum.programChanges += q.programChanges;
+        queueSum.vertexArrayChanges += q.vertexArrayChanges;
+        queueSum.textureChanges += q.textureChanges;
+
+        const MockGLCounters &c = MockGL::counters();
+        sum.calls += c.calls;
+        sum.draws += c.draws;
+        sum.uniforms += c.uniforms;
+        sum.binds += c.binds;
+        sum.uploads += c.uploads;
+        sum.uploadBytes += c.uploadBytes;
+        worst.calls = std::max(worst.calls, c.calls);
+        worst.draws = std::max(worst.draws, c.draws);
+        worst.uploadBytes = std::max(worst.uploadBytes, c.uploadBytes);
+        if(c.draws > budget){
+            if(overBudget == 0){
+                std::printf("frame %d: %llu draw calls (budget %u):\n", frame, (unsigned long long)c.draws, budget);
+                for(const MockGLEvent &event : MockGL::timeline)
+                    if(MockGL::category((int)event.function) == MOCKGL_DRAW)
+                        std::printf("  %8llu ns  %s\n", (unsigned long long)event.nanoseconds, MockGL::name(event.function));
+            }
+            overBudget++;
+        }
+    }
+
+    std::sort(frameNanoseconds.begin(), frameNanoseconds.end());
+    double total = 0.0;
+    for(double ns : frameNanoseconds)
+        total += ns;
+    double n = (double)frames;
+
+    std::printf("%d frames, draw() time: min %.0f ns, avg %.0f ns, p99 %.0f ns\n", frames,
+                frameNanoseconds.front(), total / n, frameNanoseconds[(size_t)((n - 1) * 0.99)]);
+    std::printf("per frame (avg / worst): calls %.1f / %llu, draws %.1f / %llu, uniforms %.1f, binds %.1f, uploads %.1f, bytes %.1f / %llu\n",
+                sum.calls / n, (unsigned long long)worst.calls, sum.draws / n, (unsigned long long)worst.draws,
+                sum.uniforms / n, sum.binds / n, sum.uploads / n, sum.uploadBytes / n, (unsigned long long)worst.uploadBytes);
+    std::printf("render queue per frame: commands %.1f, program changes %.1f, VAO changes %.1f, texture changes %.1f\n",
+                queueSum.commands / n, queueSum.programChanges / n, queueSum.vertexArrayChanges / n, queueSum.textureChanges / n);
+
+    if(overBudget > 0){
+        std::printf("FAIL: %d of %d frames over the budget of %u draw calls\n", overBudget, frames, budget);
+        return 1;
+    }
+    std::printf("OK: every frame within %u draw calls\n", budget);
+    return 0;
+}
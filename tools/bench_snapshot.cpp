@@ -0,0 +1,162 @@
+// cost of checkpointing a World (snapshot.h) and proof that restoring one
+// is exact: times saveSnapshot()/restoreSnapshot() on the built-in level
+// (or a level file) mid-game, with some balls spawned and destroyed so the
+// pool's free list is in play, then plays on from a snapshot twice -
+// once in the same World after rolling back, once in a freshly built one -
+// and fails (exit 1) unless both end in the state the original run did.
+// also times a rollback loop like a rollback netcode would run: every tick
+// restore the state of a few ticks ago and simulate forward again, and
+// checks that truncated snapshots and corrupt free lists are rejected
+//
+//   bench_snapshot [iterations] [level file]
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "controller.h"
+#include "snapshot.h"
+
+const int WARMUP_TICKS = 5000;
+const int PLAY_ON_TICKS = 20000;
+const int ROLLBACK_TICKS = 8;
+
+// autopilot from the current state for ticks, returning the final hash
+static uint64_t playOn(World &world, int ticks)
+{
+    AutopilotController autopilot;
+    for(int tick = 0; tick < ticks; tick++)
+        world.step(autopilot.next(world));
+    return world.stateHash();
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    const char *level = argc > 2 ? argv[2] : NULL;
+    if(iterations <= 0){
+        std::printf("usage: %s [iterations] [level file]\n", argv[0]);
+        return 2;
+    }
+
+    World world;
+    if(level != NULL && !world.loadLevel(level))
+        return 1;
+
+    // a second and third ball, one destroyed again, so the snapshot
+    // carries a live handle, a stale generation and a free slot
+    EntityHandle extra = world.spawnBall(0.0f, 1.0f, -1.7f, 2.3f);
+    world.spawnBall(1.0f, -1.0f, 2.4f, -1.1f);
+    playOn(world, WARMUP_TICKS);
+    world.destroyBall(extra);
+
+    std::vector<uint8_t> snapshot;
+    saveSnapshot(world, snapshot);
+    std::printf("%s: %zu targets (%zu active), %zu balls, tick %" PRIu64 ", snapshot %zu bytes\n", level != NULL ? level : "default level",
+                world.targets.size(), world.targets.activeCount(), world.balls.size(), world.tick, snapshot.size());
+
+    // timing: save into the same buffer, restore the same state
+    std::vector<uint8_t> scratch;
+    volatile uint8_t sink = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int i = 0; i < iterations; i++){
+        saveSnapshot(world, scratch);
+        sink = scratch.back();
+    }
+    double saveSeconds = secondsSince(start);
+    (void)sink;
+
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < iterations; i++)
+        restoreSnapshot(world, snapshot);
+    double restoreSeconds = secondsSince(start);
+
+    std::printf("save %.1f ns, restore %.1f ns (%d iterations)\n", saveSeconds / iterations * 1e9, restoreSeconds / iterations * 1e9, iterations);
+
+    // exactness: play on, roll back, play on again, and the same from a
+    // World that starts out on a different layout
+    restoreSnapshot(world, snapshot);
+    uint64_t expected = playOn(world, PLAY_ON_TICKS);
+    unsigned int layoutVersion = world.targets.layoutVersion;
+    unsigned int activeVersion = world.targets.activeVersion;
+    restoreSnapshot(world, snapshot);
+    bool versionsBumped = world.targets.activeVersion != activeVersion && world.targets.layoutVersion == layoutVersion;
+    uint64_t rolledBack = playOn(world, PLAY_ON_TICKS);
+
+    World fresh;
+    fresh.setTargets({});
+    unsigned int freshLayoutVersion = fresh.targets.layoutVersion;
+    if(!restoreSnapshot(fresh, snapshot))
+        return 1;
+    versionsBumped = versionsBumped && fresh.targets.layoutVersion != freshLayoutVersion;
+    uint64_t restored = playOn(fresh, PLAY_ON_TICKS);
+
+    std::printf("after %d more ticks: original %016" PRIx64 ", rolled back %016" PRIx64 ", fresh World %016" PRIx64 "\n",
+                PLAY_ON_TICKS, expected, rolledBack, restored);
+
+    // rollback loop: each tick, rewind ROLLBACK_TICKS and resimulate them
+    restoreSnapshot(world, snapshot);
+    std::vector<std::vector<uint8_t> > history(ROLLBACK_TICKS);
+    AutopilotController autopilot;
+    int rollbackTicks = PLAY_ON_TICKS;
+    start = std::chrono::steady_clock::now();
+    for(int tick = 0; tick < rollbackTicks; tick++){
+        saveSnapshot(world, history[tick % ROLLBACK_TICKS]);
+        world.step(autopilot.next(world));
+        if(tick >= ROLLBACK_TICKS){
+            restoreSnapshot(world, history[(tick + 1) % ROLLBACK_TICKS]);
+            for(int i = 0; i < ROLLBACK_TICKS; i++)
+                world.step(autopilot.next(world));
+        }
+    }
+    double rollbackSeconds = secondsSince(start);
+    std::printf("rollback of %d ticks every tick: %.2f us per tick\n", ROLLBACK_TICKS, rollbackSeconds / rollbackTicks * 1e6);
+
+    bool failed = false;
+    if(rolledBack != expected || restored != expected){
+        std::printf("FAIL: play from a restored snapshot diverged\n");
+        failed = true;
+    }
+    if(!versionsBumped){
+        std::printf("FAIL: restore did not bump the target versions it should have\n");
+        failed = true;
+    }
+    snapshot.resize(snapshot.size() - 1);
+    if(restoreSnapshot(fresh, snapshot)){
+        std::printf("FAIL: truncated snapshot was accepted\n");
+        failed = true;
+    }
+
+    // a free list link out of range, pointing at a live slot or looping
+    // back must be rejected, or the next spawn would hand out a bad slot
+    saveSnapshot(world, snapshot);
+    SnapshotHeader header;
+    std::memcpy(&header, snapshot.data(), sizeof(header));
+    size_t slotTable = sizeof(header) + header.ballCount * (sizeof(Ball) + sizeof(uint32_t));
+    uint32_t liveSlot;
+    std::memcpy(&liveSlot, snapshot.data() + sizeof(header) + header.ballCount * sizeof(Ball), sizeof(liveSlot));
+    const uint32_t badLinks[] = { header.ballSlotCount + 5, liveSlot, header.ballFreeHead };
+    for(uint32_t badLink : badLinks){
+        std::vector<uint8_t> corrupt = snapshot;
+        EntityPool<Ball>::Slot slot;
+        size_t offset = slotTable + header.ballFreeHead * sizeof(slot);
+        std::memcpy(&slot, corrupt.data() + offset, sizeof(slot));
+        slot.dense = badLink;
+        std::memcpy(corrupt.data() + offset, &slot, sizeof(slot));
+        if(header.ballFreeHead == EntityHandle::INVALID_INDEX || restoreSnapshot(fresh, corrupt)){
+            std::printf("FAIL: snapshot with a corrupt free list link (%u) was accepted\n", badLink);
+            failed = true;
+        }
+    }
+    if(failed)
+        return 1;
+    std::printf("OK: restored games play out identically\n");
+    return 0;
+}
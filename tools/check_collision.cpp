@@ -0,0 +1,89 @@
+// edge cases of the swept collision tests in collision.h: a ball that starts
+// exactly touching a surface (or within CONTACT_SLOP of it) and moves into it
+// must still get a contact at t = 0, one moving away from it must not, and a
+// ball stepped tick by tick against a target and the paddle must never end
+// a tick inside either. fails (exit 1) on the first case that does not hold
+//
+//   check_collision
+
+#include <cmath>
+#include <cstdio>
+#include "collision.h"
+#include "world.h"
+
+static int failures = 0;
+
+static void expect(bool condition, const char *name)
+{
+    std::printf("%-4s %s\n", condition ? "ok" : "FAIL", name);
+    if(!condition)
+        failures++;
+}
+
+static bool sweep(glm::vec2 p, glm::vec2 d, Contact &contact)
+{
+    return sweepCircleAABB(p, d, 0.5f, glm::vec2(0.0f), glm::vec2(0.5f), contact);
+}
+
+int main()
+{
+    Contact contact;
+
+    // faces
+    bool hit = sweep(glm::vec2(-1.5f, 0.0f), glm::vec2(1.0f, 0.0f), contact);
+    expect(hit && std::fabs(contact.t - 0.5f) < 1e-6f && contact.normal == glm::vec2(-1.0f, 0.0f), "head-on hit halfway");
+
+    hit = sweep(glm::vec2(-1.0f, 0.0f), glm::vec2(0.1f, 0.0f), contact);
+    expect(hit && contact.t == 0.0f && !contact.overlapping && contact.normal == glm::vec2(-1.0f, 0.0f), "touching a face at the start, moving in");
+
+    hit = sweep(glm::vec2(-1.0f + 5e-5f, 0.0f), glm::vec2(0.1f, 0.0f), contact);
+    expect(hit && contact.t == 0.0f && contact.normal == glm::vec2(-1.0f, 0.0f), "within CONTACT_SLOP of a face, moving in");
+
+    hit = sweep(glm::vec2(0.0f, 1.0f), glm::vec2(0.03f, -0.1f), contact);
+    expect(hit && contact.t == 0.0f && contact.normal == glm::vec2(0.0f, 1.0f), "touching the top face, moving in at an angle");
+
+    hit = sweep(glm::vec2(-1.0f, 0.0f), glm::vec2(-0.1f, 0.0f), contact);
+    expect(!hit, "touching a face at the start, moving away");
+
+    hit = sweep(glm::vec2(-1.0f, 0.0f), glm::vec2(0.0f, 0.1f), contact);
+    expect(!hit, "touching a face at the start, sliding along it");
+
+    hit = sweep(glm::vec2(2.0f, 0.0f), glm::vec2(1.0f, 0.0f), contact);
+    expect(!hit, "box behind the ball");
+
+    // rounded corners
+    float diagonal = 0.5f + 0.5f / std::sqrt(2.0f);
+    hit = sweep(glm::vec2(diagonal, diagonal), glm::vec2(-0.1f, -0.1f), contact);
+    expect(hit && contact.t < 1e-4f && contact.normal.x > 0.7f && contact.normal.y > 0.7f, "touching a corner at the start, moving in");
+
+    hit = sweep(glm::vec2(diagonal, diagonal), glm::vec2(0.1f, 0.1f), contact);
+    expect(!hit, "touching a corner at the start, moving away");
+
+    // a ball resting against a target after bouncing off the floor, pushed
+    // into the target tick after tick, never ends up inside it
+    World world;
+    world.setTargets({ Square(0.0f, -1.5f, 0.0f, true) });
+    world.targets.hitPoints[0] = 255;
+    Ball &ball = world.balls[0];
+    ball.x = -1.0f;
+    ball.y = -World::BOUNDS_Y;
+    ball.velocityX = 3.0f;
+    ball.velocityY = -0.5f;
+    InputFrame input;
+    bool inside = false;
+    for(int tick = 0; tick < 2000; tick++){
+        world.step(input);
+        const Ball &b = world.balls[0];
+        glm::vec2 closest = glm::clamp(glm::vec2(b.x, b.y), glm::vec2(-0.5f, -2.0f), glm::vec2(0.5f, -1.0f));
+        if(glm::length(glm::vec2(b.x, b.y) - closest) < World::CIRCLE_RADIUS - 2.0f * CONTACT_SLOP)
+            inside = true;
+    }
+    expect(!inside, "ball sliding along the floor into a target stays outside it");
+
+    if(failures > 0){
+        std::printf("FAIL: %d case(s)\n", failures);
+        return 1;
+    }
+    std::printf("OK: all cases hold\n");
+    return 0;
+}
@@ -0,0 +1,57 @@
+// replay an input recording (inputrecord.h) headless at full speed and
+// check the game ends in exactly the recorded state. a recording made on a
+// level file needs the same file; the level hash catches a wrong one
+//
+//   replay <recording> [level file]
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include "inputrecord.h"
+#include "world.h"
+
+int main(int argc, char **argv)
+{
+    if(argc < 2 || argc > 3){
+        std::printf("usage: %s <recording> [level file]\n", argv[0]);
+        return 2;
+    }
+
+    InputRecording recording;
+    if(!recording.load(argv[1]))
+        return 1;
+    if(recording.tickRate != (uint32_t)SIM_TICK_RATE){
+        std::printf("recorded at %u ticks/s, this build runs %.0f\n", recording.tickRate, SIM_TICK_RATE);
+        return 1;
+    }
+
+    World world(recording.seed);
+    if(argc > 2 && !world.loadLevel(argv[2]))
+        return 1;
+    if(world.levelHash() != recording.levelHash){
+        std::printf("level hash %016" PRIx64 " does not match the recording's %016" PRIx64 "%s\n", world.levelHash(), recording.levelHash,
+                    argc > 2 ? "" : " (was it made on a level file?)");
+        return 1;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    bool complete = recording.forEachRun([&world](const InputFrame &input, uint64_t ticks){
+        for(uint64_t i = 0; i < ticks; i++)
+            world.step(input);
+    });
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if(!complete){
+        std::printf("%s: input stream is corrupt\n", argv[1]);
+        return 1;
+    }
+
+    uint64_t hash = world.stateHash();
+    std::printf("%" PRIu64 " ticks (%.1f s of play) in %.3f s, %.2f M ticks/s, score %d\n", recording.tickCount,
+                recording.tickCount / SIM_TICK_RATE, seconds, recording.tickCount / seconds / 1e6, world.score);
+    if(hash != recording.finalStateHash){
+        std::printf("FAIL: final state %016" PRIx64 ", recorded %016" PRIx64 "\n", hash, recording.finalStateHash);
+        return 1;
+    }
+    std::printf("OK: final state %016" PRIx64 " matches\n", hash);
+    return 0;
+}
@@ -0,0 +1,291 @@
+// run many independent games headless across every core, for balancing
+// paddle strategies. each game is its own World (seed = base seed + game
+// number, which picks the ball's launch) whose paddle is driven by one of
+// the Controllers below or the AutopilotController (controller.h) for a
+// fixed length of play. the whole batch is run once per thread count,
+// from 1 up to all cores, on a work-stealing JobPool (jobpool.h), reporting
+// throughput, ticks/s per core and the speedup over one thread, then the
+// score distribution. games are deterministic, so every pass must produce
+// the same results; fails (exit 1) if one does not
+//
+//   shape_shift_batch [--games N] [--seconds S] [--strategy idle|sweep|random|track|autopilot]
+//                     [--threads N] [--seed N] [level file]
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "controller.h"
+#include "jobpool.h"
+#include "world.h"
+
+enum Strategy
+{
+    STRATEGY_IDLE,      // never move
+    STRATEGY_SWEEP,     // run from end to end
+    STRATEGY_RANDOM,    // hold a random direction for a random time
+    STRATEGY_TRACK,     // follow the height of the nearest incoming ball
+    STRATEGY_AUTOPILOT, // AutopilotController: move to the predicted intercept
+    STRATEGY_COUNT
+};
+
+static const char *STRATEGY_NAMES[STRATEGY_COUNT] = { "idle", "sweep", "random", "track", "autopilot" };
+
+struct BatchSettings
+{
+    size_t games = 1000;
+    double seconds = 60.0;
+    Strategy strategy = STRATEGY_AUTOPILOT;
+    unsigned int maxThreads = 0;
+    uint64_t seed = DEFAULT_WORLD_SEED;
+    const char *level = NULL;
+};
+
+struct GameResult
+{
+    int score;
+    uint64_t stateHash;
+};
+
+static float randomRange(World &world, float lo, float hi)
+{
+    return lo + (hi - lo) * (float)(world.nextRandom() & 0xFFFFFF) / (float)0xFFFFFF;
+}
+
+class IdleController : public Controller
+{
+public:
+    InputFrame next(const World &) override { return InputFrame(); }
+};
+
+class SweepController : public Controller
+{
+public:
+    InputFrame next(const World &world) override
+    {
+        if(world.paddleY >= World::BOUNDS_Y)
+            bits = 2;
+        else if(world.paddleY <= -World::BOUNDS_Y || bits == 0)
+            bits = 1;
+        return InputFrame::fromBits(bits);
+    }
+
+private:
+    uint8_t bits = 0;
+};
+
+// its own xorshift stream, seeded from the world's seed so the game still
+// reproduces from the seed alone
+class RandomController : public Controller
+{
+public:
+    explicit RandomController(uint64_t seed) : state(seed != 0 ? seed : DEFAULT_WORLD_SEED) {}
+
+    InputFrame next(const World &) override
+    {
+        if(holdTicks == 0){
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            bits = (uint8_t)(state % 3);
+            holdTicks = 50 + (uint32_t)((state >> 8) % 500);
+        }
+        holdTicks -= 1;
+        return InputFrame::fromBits(bits);
+    }
+
+private:
+    uint64_t state;
+    uint8_t bits = 0;
+    uint32_t holdTicks = 0;
+};
+
+class TrackController : public Controller
+{
+public:
+    InputFrame next(const World &world) override
+    {
+        const Ball *nearest = NULL;
+        for(const Ball &ball : world.balls)
+            if(ball.velocityX < 0.0f && (nearest == NULL || ball.x < nearest->x))
+                nearest = &ball;
+        float target = nearest != NULL ? nearest->y : 0.0f;
+        InputFrame input;
+        input.up = world.paddleY < target - 0.05f;
+        input.down = world.paddleY > target + 0.05f;
+        return input;
+    }
+};
+
+static std::unique_ptr<Controller> makeController(Strategy strategy, uint64_t seed)
+{
+    switch(strategy){
+        case STRATEGY_SWEEP: return std::unique_ptr<Controller>(new SweepController());
+        case STRATEGY_RANDOM: return std::unique_ptr<Controller>(new RandomController(seed));
+        case STRATEGY_TRACK: return std::unique_ptr<Controller>(new TrackController());
+        case STRATEGY_AUTOPILOT: return std::unique_ptr<Controller>(new AutopilotController());
+        default: return std::unique_ptr<Controller>(new IdleController());
+    }
+}
+
+// play one game to the end
+// ------------------------------------------------------------------------
+static GameResult playGame(const BatchSettings &settings, size_t game, uint64_t ticks)
+{
+    World world(settings.seed + game);
+    if(settings.level != NULL)
+        world.loadLevel(settings.level);
+
+    // launch the ball from a random height at a random angle
+    Ball &ball = world.balls[0];
+    ball.y = randomRange(world, -2.0f, 2.0f);
+    ball.velocityY = randomRange(world, -3.0f, 3.0f);
+
+    std::unique_ptr<Controller> controller = makeController(settings.strategy, world.seed);
+    for(uint64_t tick = 0; tick < ticks; tick++)
+        world.step(controller->next(world));
+
+    GameResult result;
+    result.score = world.score;
+    result.stateHash = world.stateHash();
+    return result;
+}
+
+static bool parseArguments(int argc, char **argv, BatchSettings &settings)
+{
+    for(int i = 1; i < argc; i++){
+        bool hasValue = i + 1 < argc;
+        if(std::strcmp(argv[i], "--games") == 0 && hasValue)
+            settings.games = (size_t)std::strtoull(argv[++i], NULL, 10);
+        else if(std::strcmp(argv[i], "--seconds") == 0 && hasValue)
+            settings.seconds = std::atof(argv[++i]);
+        else if(std::strcmp(argv[i], "--threads") == 0 && hasValue)
+            settings.maxThreads = (unsigned int)std::atoi(argv[++i]);
+        else if(std::strcmp(argv[i], "--seed") == 0 && hasValue)
+            settings.seed = std::strtoull(argv[++i], NULL, 0);
+        else if(std::strcmp(argv[i], "--strategy") == 0 && hasValue){
+            const char *name = argv[++i];
+            int found = -1;
+            for(int s = 0; s < STRATEGY_COUNT; s++)
+                if(std::strcmp(name, STRATEGY_NAMES[s]) == 0)
+                    found = s;
+            if(found < 0)
+                return false;
+            settings.strategy = (Strategy)found;
+        }
+        else if(argv[i][0] != '-' && settings.level == NULL)
+            settings.level = argv[i];
+        else
+            return false;
+    }
+    return settings.games > 0 && settings.seconds > 0.0;
+}
+
+int main(int argc, char **argv)
+{
+    BatchSettings settings;
+    if(!parseArguments(argc, argv, settings)){
+        std::printf("usage: %s [--games N] [--seconds S] [--strategy idle|sweep|random|track|autopilot] [--threads N] [--seed N] [level file]\n", argv[0]);
+        return 2;
+    }
+    if(settings.level != NULL){
+        World probe;
+        if(!probe.loadLevel(settings.level))
+            return 1;
+    }
+
+    uint64_t ticksPerGame = (uint64_t)(settings.seconds * SIM_TICK_RATE);
+    double totalTicks = (double)ticksPerGame * (double)settings.games;
+    unsigned int maxThreads = settings.maxThreads > 0 ? settings.maxThreads : JobPool::hardwareThreads();
+    std::printf("%zu games of %.0f s (%" PRIu64 " ticks), strategy %s, seed %" PRIu64 ", %s, up to %u threads\n",
+                settings.games, settings.seconds, ticksPerGame, STRATEGY_NAMES[settings.strategy], settings.seed,
+                settings.level != NULL ? settings.level : "default level", maxThreads);
+
+    // 1, 2, 4, ... and finally every thread
+    std::vector<unsigned int> threadCounts;
+    for(unsigned int threads = 1; threads < maxThreads; threads *= 2)
+        threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    std::vector<GameResult> reference;
+    std::vector<GameResult> results(settings.games);
+    double singleThreadSeconds = 0.0;
+    bool consistent = true;
+
+    std::printf("%8s %10s %14s %18s %8s %11s %8s\n", "threads", "seconds", "M ticks/s", "M ticks/s/thread", "speedup", "efficiency", "stolen");
+    for(unsigned int threads : threadCounts){
+        JobPool pool(threads);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        pool.run(settings.games, [&](size_t game, unsigned int){
+            results[game] = playGame(settings, game, ticksPerGame);
+        });
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        uint64_t stolen = 0;
+        for(unsigned int worker = 0; worker < pool.size(); worker++)
+            stolen += pool.stats(worker).stolen;
+
+        if(threads == 1)
+            singleThreadSeconds = seconds;
+        double speedup = singleThreadSeconds / seconds;
+        std::printf("%8u %10.3f %14.2f %18.2f %7.2fx %10.0f%% %8" PRIu64 "\n", threads, seconds, totalTicks / seconds / 1e6,
+                    totalTicks / seconds / 1e6 / threads, speedup, 100.0 * speedup / threads, stolen);
+
+        if(reference.empty()){
+            reference = results;
+            continue;
+        }
+        for(size_t game = 0; game < settings.games; game++){
+            if(results[game].stateHash != reference[game].stateHash){
+                if(consistent)
+                    std::printf("game %zu ended in state %016" PRIx64 " on %u threads, %016" PRIx64 " on 1\n", game,
+                                results[game].stateHash, threads, reference[game].stateHash);
+                consistent = false;
+            }
+        }
+    }
+
+    // score distribution
+    std::vector<int> scores(settings.games);
+    double sum = 0.0;
+    for(size_t game = 0; game < settings.games; game++){
+        scores[game] = reference[game].score;
+        sum += scores[game];
+    }
+    std::sort(scores.begin(), scores.end());
+    size_t last = scores.size() - 1;
+    std::printf("score: min %d, p10 %d, median %d, p90 %d, max %d, mean %.2f\n", scores.front(), scores[last / 10],
+                scores[last / 2], scores[last * 9 / 10], scores.back(), sum / (double)scores.size());
+
+    const int BUCKETS = 10;
+    int lo = scores.front();
+    int width = std::max(1, (scores.back() - lo + BUCKETS) / BUCKETS);
+    std::vector<size_t> histogram(BUCKETS, 0);
+    for(int score : scores)
+        histogram[std::min(BUCKETS - 1, (score - lo) / width)] += 1;
+    size_t tallest = *std::max_element(histogram.begin(), histogram.end());
+    for(int bucket = 0; bucket < BUCKETS; bucket++){
+        if(lo + bucket * width > scores.back())
+            break;
+        int first = lo + bucket * width;
+        char range[32];
+        if(width == 1)
+            std::snprintf(range, sizeof(range), "%d", first);
+        else
+            std::snprintf(range, sizeof(range), "%d-%d", first, first + width - 1);
+        int bar = (int)(40 * histogram[bucket] / tallest);
+        std::printf("  %13s %7zu %s\n", range, histogram[bucket], std::string(bar, '#').c_str());
+    }
+
+    if(!consistent){
+        std::printf("FAIL: results depend on the thread count\n");
+        return 1;
+    }
+    std::printf("OK: identical results on every thread count\n");
+    return 0;
+}
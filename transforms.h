@@ -0,0 +1,110 @@
+#ifndef TRANSFORMS_H
+#define TRANSFORMS_H
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// one world matrix as the GPU reads it (four vec4 columns of a per-instance
+// attribute); 16-byte aligned so the array can be copied into an instance
+// buffer, or loaded with aligned SIMD, as it is
+struct alignas(16) InstanceTransform
+{
+    glm::mat4 matrix;
+};
+
+static_assert(sizeof(InstanceTransform) == 64, "instance transforms are uploaded as packed mat4s");
+
+// world matrices of a set of entities in a dense array indexed like the
+// entities themselves. callers set each entity's placement every frame;
+// only entries whose placement actually changed are rebuilt by update(),
+// and the range touched since the last upload is tracked so a partial
+// buffer update can send just that
+// ------------------------------------------------------------------------
+class TransformArray
+{
+public:
+    // new entries start out dirty
+    void resize(size_t count)
+    {
+        size_t old = placements.size();
+        if(count < old)
+            dirtyList.erase(std::remove_if(dirtyList.begin(), dirtyList.end(), [count](uint32_t i){ return i >= count; }), dirtyList.end());
+        placements.resize(count, glm::vec3(0.0f, 0.0f, 1.0f));
+        transforms.resize(count);
+        dirty.resize(count, 0);
+        for(size_t i = old; i < count; i++)
+            markDirty(i);
+        if(uploadEnd > count)
+            uploadEnd = count;
+        if(uploadBegin > uploadEnd)
+            uploadBegin = uploadEnd;
+    }
+
+    size_t size() const { return placements.size(); }
+
+    // translation plus uniform scale
+    void set(size_t i, float x, float y, float scale = 1.0f)
+    {
+        glm::vec3 placement(x, y, scale);
+        if(placements[i] == placement)
+            return;
+        placements[i] = placement;
+        markDirty(i);
+    }
+
+    // rebuild every dirty matrix; returns how many were rebuilt
+    // ------------------------------------------------------------------------
+    size_t update()
+    {
+        size_t rebuilt = dirtyList.size();
+        for(uint32_t i : dirtyList){
+            const glm::vec3 &p = placements[i];
+            glm::mat4 &m = transforms[i].matrix;
+            m = glm::mat4(p.z);
+            m[3] = glm::vec4(p.x, p.y, 0.0f, 1.0f);
+            dirty[i] = 0;
+            if(uploadBegin == uploadEnd){
+                uploadBegin = i;
+                uploadEnd = i + 1;
+            }
+            else{
+                uploadBegin = std::min(uploadBegin, (size_t)i);
+                uploadEnd = std::max(uploadEnd, (size_t)i + 1);
+            }
+        }
+        dirtyList.clear();
+        return rebuilt;
+    }
+
+    const InstanceTransform* data() const { return transforms.data(); }
+
+    // entries rebuilt since the last markUploaded(); empty when equal
+    size_t uploadRangeBegin() const { return uploadBegin; }
+    size_t uploadRangeEnd() const { return uploadEnd; }
+    void markUploaded()
+    {
+        uploadBegin = 0;
+        uploadEnd = 0;
+    }
+
+private:
+    std::vector<glm::vec3> placements;      // x, y, scale
+    std::vector<InstanceTransform> transforms;
+    std::vector<uint8_t> dirty;
+    std::vector<uint32_t> dirtyList;
+    size_t uploadBegin = 0;
+    size_t uploadEnd = 0;
+
+    void markDirty(size_t i)
+    {
+        if(dirty[i])
+            return;
+        dirty[i] = 1;
+        dirtyList.push_back((uint32_t)i);
+    }
+};
+
+#endif
@@ -0,0 +1,383 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cmath>
+#include "square.h"
+#include "targetfield.h"
+#include "targetgrid.h"
+#include "level.h"
+#include "collision.h"
+#include "entitypool.h"
+#include "profiler.h"
+
+// the simulation runs at a fixed rate independent of the display; velocities
+// below are in units per second
+const double SIM_TICK_RATE = 1000.0;
+const float SIM_DT = (float)(1.0 / SIM_TICK_RATE);
+
+// seed of a World built without one
+const uint64_t DEFAULT_WORLD_SEED = 0x5348415045ull; // "SHAPE"
+
+// 64-bit FNV-1a, continued from hash over size bytes
+inline uint64_t hashBytes(uint64_t hash, const void *data, size_t size)
+{
+    const unsigned char *bytes = (const unsigned char*)data;
+    for(size_t i = 0; i < size; i++){
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+const uint64_t HASH_START = 14695981039346656037ull;
+
+// input for a single simulation tick, filled from the keyboard by the windowed
+// build and from scripts/controllers by the headless tools
+// ------------------------------------------------------------------------
+struct InputFrame
+{
+    bool up = false;
+    bool down = false;
+
+    // one bit per control, the form inputs are recorded in (inputrecord.h)
+    uint8_t bits() const
+    {
+        return (uint8_t)((up ? 1u : 0u) | (down ? 2u : 0u));
+    }
+    static InputFrame fromBits(uint8_t bits)
+    {
+        InputFrame input;
+        input.up = (bits & 1u) != 0;
+        input.down = (bits & 2u) != 0;
+        return input;
+    }
+};
+
+// a ball in play; velocities in units per second
+struct Ball
+{
+    float x;
+    float y;
+    float velocityX;
+    float velocityY;
+};
+
+struct BallMotion
+{
+    EntityHandle handle;
+    float x;
+    float y;
+};
+
+// positions of everything that moves, captured each tick so the renderer can
+// interpolate between the previous and current simulation state
+// ------------------------------------------------------------------------
+struct MotionState
+{
+    float paddleX;
+    float paddleY;
+    std::vector<BallMotion> balls;
+};
+
+// blend into result (reusing its storage); balls are matched by handle, and
+// one that only exists in b (spawned this tick) is drawn where b has it
+// ------------------------------------------------------------------------
+inline void lerp(const MotionState &a, const MotionState &b, float t, MotionState &result)
+{
+    result.paddleX = a.paddleX + (b.paddleX - a.paddleX) * t;
+    result.paddleY = a.paddleY + (b.paddleY - a.paddleY) * t;
+    result.balls.resize(b.balls.size());
+    for(size_t i = 0; i < b.balls.size(); i++){
+        const BallMotion &to = b.balls[i];
+        // dense order rarely changes between two ticks, try the same spot first
+        const BallMotion *from = NULL;
+        if(i < a.balls.size() && a.balls[i].handle == to.handle)
+            from = &a.balls[i];
+        for(size_t j = 0; from == NULL && j < a.balls.size(); j++)
+            if(a.balls[j].handle == to.handle)
+                from = &a.balls[j];
+        if(from == NULL)
+            from = &to;
+        result.balls[i].handle = to.handle;
+        result.balls[i].x = from->x + (to.x - from->x) * t;
+        result.balls[i].y = from->y + (to.y - from->y) * t;
+    }
+}
+
+inline MotionState lerp(const MotionState &a, const MotionState &b, float t)
+{
+    MotionState result;
+    lerp(a, b, t, result);
+    return result;
+}
+
+// complete game state plus the update logic; has no dependency on GLFW or GL so
+// it can be stepped headless as fast as the CPU allows
+// ------------------------------------------------------------------------
+class World
+{
+public:
+    // speeds match the old per-frame deltas (0.035f, 0.045f) at 60 Hz
+    float paddleX = -4.85f;
+    float paddleY = 2.5f;
+    float paddleVelocity = 2.1f;
+
+    // every ball in play, the first one spawned by the constructor
+    EntityPool<Ball> balls;
+
+    TargetField targets;
+    int score = 0;
+
+    // ticks stepped so far, and the random stream every random decision in
+    // the simulation must draw from (so a seed plus the inputs reproduce a
+    // game exactly)
+    uint64_t tick = 0;
+    uint64_t seed = DEFAULT_WORLD_SEED;
+    uint64_t randomState = DEFAULT_WORLD_SEED;
+
+    static constexpr float CIRCLE_RADIUS = 0.5f;
+    static constexpr float PADDLE_HALF_EXTENT = 0.5f;
+
+    // ball centres stay within +-BOUNDS_X, +-BOUNDS_Y (the walls); the
+    // paddle's centre within +-BOUNDS_Y
+    static constexpr float BOUNDS_X = 4.85f;
+    static constexpr float BOUNDS_Y = 2.5f;
+
+    // default level: one ball and two columns of five targets, spacing 0.10f
+    explicit World(uint64_t worldSeed = DEFAULT_WORLD_SEED)
+        : seed(worldSeed), randomState(worldSeed != 0 ? worldSeed : DEFAULT_WORLD_SEED)
+    {
+        spawnBall(-2.0f, 0.0f, 2.1f, 2.7f);
+
+        setTargets({
+            Square(4.75f, 2.4f, 0.0f, true),
+            Square(4.75f, 1.3f, 0.0f, true),
+            Square(4.75f, 0.2f, 0.0f, true),
+            Square(4.75f, -0.9f, 0.0f, true),
+            Square(4.75f, -2.0f, 0.0f, true),
+
+            Square(3.65f, 2.4f, 0.0f, true),
+            Square(3.65f, 1.3f, 0.0f, true),
+            Square(3.65f, 0.2f, 0.0f, true),
+            Square(3.65f, -0.9f, 0.0f, true),
+            Square(3.65f, -2.0f, 0.0f, true),
+        });
+    }
+
+    // replace the level layout
+    // ------------------------------------------------------------------------
+    void setTargets(const std::vector<Square> &layout)
+    {
+        targets.clear();
+        targets.reserve(layout.size());
+        for(const Square &square : layout)
+            targets.add(square.getX(), square.getY(), square.getActive());
+    }
+
+    // replace the targets with a binary level file (level.h); the current
+    // layout is kept if the file cannot be loaded
+    bool loadLevel(const std::string &path)
+    {
+        return ::loadLevel(path, targets);
+    }
+
+    EntityHandle spawnBall(float x, float y, float velocityX, float velocityY)
+    {
+        Ball ball = { x, y, velocityX, velocityY };
+        return balls.spawn(ball);
+    }
+
+    bool destroyBall(EntityHandle ball)
+    {
+        return balls.destroy(ball);
+    }
+
+    // fill out (reusing its storage, so capturing every tick never allocates
+    // once the ball count has peaked)
+    void motion(MotionState &out) const
+    {
+        out.paddleX = paddleX;
+        out.paddleY = paddleY;
+        out.balls.resize(balls.size());
+        for(size_t i = 0; i < balls.size(); i++){
+            out.balls[i].handle = balls.handleAt(i);
+            out.balls[i].x = balls[i].x;
+            out.balls[i].y = balls[i].y;
+        }
+    }
+
+    MotionState motion() const
+    {
+        MotionState result;
+        motion(result);
+        return result;
+    }
+
+    // xorshift64 draw from the world's random stream
+    uint64_t nextRandom()
+    {
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 7;
+        randomState ^= randomState << 17;
+        return randomState;
+    }
+
+    // hash of the targets (positions, hit points, active flags); taken
+    // before the first tick it identifies the level a recording was made on
+    // ------------------------------------------------------------------------
+    uint64_t levelHash() const
+    {
+        uint64_t hash = HASH_START;
+        uint64_t count = targets.size();
+        hash = hashBytes(hash, &count, sizeof(count));
+        hash = hashBytes(hash, targets.x.data(), sizeof(float) * targets.size());
+        hash = hashBytes(hash, targets.y.data(), sizeof(float) * targets.size());
+        hash = hashBytes(hash, targets.hitPoints.data(), targets.size());
+        hash = hashBytes(hash, targets.active.data(), sizeof(uint32_t) * targets.active.size());
+        return hash;
+    }
+
+    // hash of everything the simulation evolves; two runs that end on the
+    // same hash played out identically
+    // ------------------------------------------------------------------------
+    uint64_t stateHash() const
+    {
+        uint64_t hash = HASH_START;
+        hash = hashBytes(hash, &tick, sizeof(tick));
+        hash = hashBytes(hash, &randomState, sizeof(randomState));
+        hash = hashBytes(hash, &paddleX, sizeof(paddleX));
+        hash = hashBytes(hash, &paddleY, sizeof(paddleY));
+        hash = hashBytes(hash, &score, sizeof(score));
+        for(size_t i = 0; i < balls.size(); i++){
+            const Ball &ball = balls[i];
+            float values[4] = { ball.x, ball.y, ball.velocityX, ball.velocityY };
+            hash = hashBytes(hash, values, sizeof(values));
+        }
+        hash = hashBytes(hash, targets.active.data(), sizeof(uint32_t) * targets.active.size());
+        hash = hashBytes(hash, targets.hitPoints.data(), targets.hitPoints.size());
+        return hash;
+    }
+
+    // advance the game by one tick of dt seconds
+    // ------------------------------------------------------------------------
+    void step(const InputFrame &input, float dt = SIM_DT)
+    {
+        tick += 1;
+
+        // paddle
+
+        if(input.down){
+            if(paddleY > -BOUNDS_Y){
+                paddleY = paddleY + (-1.0f * paddleVelocity * dt);
+            }
+        }
+
+        if(input.up){
+            if(paddleY < BOUNDS_Y){
+                paddleY = paddleY + (1.0f * paddleVelocity * dt);
+            }
+        }
+
+        PROFILE_ZONE("collision");
+
+        for(Ball &ball : balls)
+            stepBall(ball, dt);
+    }
+
+private:
+    // a tick resolves at most this many bounces; anything left is dropped
+    static const int MAX_CONTACTS_PER_TICK = 4;
+
+    // below this many targets a SIMD sweep of the whole field beats the grid
+    static const size_t GRID_MIN_TARGETS = 256;
+
+    TargetGrid targetGrid;
+    unsigned int gridLayoutVersion = 0;
+    std::vector<unsigned int> candidates;
+
+    // sweep one ball along its path, stop at the earliest contact, bounce
+    // off that surface and carry on with the rest of the tick, so fast balls
+    // cannot tunnel through targets or the paddle
+    // ------------------------------------------------------------------------
+    void stepBall(Ball &ball, float dt)
+    {
+        float remaining = 1.0f;
+        for(int iteration = 0; iteration < MAX_CONTACTS_PER_TICK && remaining > 0.0f; iteration++){
+            glm::vec2 position(ball.x, ball.y);
+            glm::vec2 motion = glm::vec2(ball.velocityX, ball.velocityY) * (dt * remaining);
+
+            Contact earliest = Contact();
+            long hitTarget = -1;
+            bool found = sweepCircleBounds(position, motion, glm::vec2(-BOUNDS_X, -BOUNDS_Y), glm::vec2(BOUNDS_X, BOUNDS_Y), earliest);
+
+            Contact contact;
+            if(sweepCircleAABB(position, motion, CIRCLE_RADIUS, glm::vec2(paddleX, paddleY), glm::vec2(PADDLE_HALF_EXTENT), contact) && (!found || contact.t < earliest.t)){
+                earliest = contact;
+                found = true;
+            }
+
+            findTargetCandidates(position, motion);
+            for(unsigned int i : candidates){
+                if(!targets.isActive(i))
+                    continue;
+                if(sweepCircleAABB(position, motion, CIRCLE_RADIUS, glm::vec2(targets.x[i], targets.y[i]), glm::vec2(TargetField::HALF_EXTENT), contact) && (!found || contact.t < earliest.t)){
+                    earliest = contact;
+                    hitTarget = (long)i;
+                    found = true;
+                }
+            }
+
+            if(!found){
+                ball.x += motion.x;
+                ball.y += motion.y;
+                break;
+            }
+
+            // move to the contact, or out of the overlap if we started inside
+            position += motion * earliest.t;
+            if(earliest.overlapping)
+                position += earliest.normal * earliest.depth;
+            ball.x = position.x;
+            ball.y = position.y;
+
+            glm::vec2 velocity(ball.velocityX, ball.velocityY);
+            if(glm::dot(velocity, earliest.normal) < 0.0f)
+                velocity = reflectVelocity(velocity, earliest.normal);
+            ball.velocityX = velocity.x;
+            ball.velocityY = velocity.y;
+
+            if(hitTarget >= 0 && targets.hit((size_t)hitTarget))
+                score += 1;
+
+            remaining *= 1.0f - earliest.t;
+        }
+    }
+
+    // targets that could be touched by a ball at position moving by motion
+    // ------------------------------------------------------------------------
+    void findTargetCandidates(glm::vec2 position, glm::vec2 motion)
+    {
+        if(targets.size() < GRID_MIN_TARGETS){
+            // any target the ball can touch this step overlaps the circle
+            // bounding the whole sweep
+            glm::vec2 middle = position + motion * 0.5f;
+            float radius = CIRCLE_RADIUS + glm::length(motion) * 0.5f;
+            targets.overlapCircle(middle.x, middle.y, radius, candidates);
+            return;
+        }
+
+        // targets never move, so the grid is only rebuilt for a new layout
+        if(gridLayoutVersion != targets.layoutVersion || targetGrid.size() != targets.size()){
+            targetGrid.build(targets);
+            gridLayoutVersion = targets.layoutVersion;
+        }
+
+        glm::vec2 lo = glm::min(position, position + motion) - glm::vec2(CIRCLE_RADIUS);
+        glm::vec2 hi = glm::max(position, position + motion) + glm::vec2(CIRCLE_RADIUS);
+        targetGrid.query(lo.x, lo.y, hi.x, hi.y, candidates);
+    }
+};
+
+#endif